@@ -0,0 +1,453 @@
+// Benchmark harness: generates a synthetic workload, computes its interface
+// surface a number of times and reports per-stage times as JSON. Lists of
+// workloads, sizes, colors or thread counts sweep over all combinations and
+// report speedups instead.
+//
+//   delaunay_interfaces_bench --workload protein --points 100000 --colors 4 --output result.json
+//   delaunay_interfaces_bench --points 1e4,1e5,1e6 --threads 1,2,4,8 --output sweep.json
+
+#include "harness.hpp"
+#include "json_writer.hpp"
+#include "sweep.hpp"
+#include "workloads.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace delaunay_interfaces;
+using namespace delaunay_interfaces::bench;
+
+namespace {
+
+struct Arguments {
+    WorkloadOptions workload;  // Of the first combination
+    RunConfig run;
+    std::vector<WorkloadKind> kinds = {WorkloadKind::Uniform};
+    std::vector<size_t> points = {10000};
+    std::vector<int> colors = {2};
+    std::vector<size_t> threads = {0};
+    std::string complex = "alpha";
+    size_t warmup = 1;
+    size_t repeat = 3;
+    std::string output;  // Empty = stdout
+    std::string trace;   // Empty = no trace
+
+    bool sweep() const { return kinds.size() * points.size() * colors.size() * threads.size() > 1; }
+};
+
+const char* kUsage =
+    "Usage: delaunay_interfaces_bench [options]\n"
+    "  --workload NAME       uniform, clustered, layered or protein (default uniform)\n"
+    "  --points N            Number of points (default 10000)\n"
+    "  --colors N            Number of colors (default 2)\n"
+    "  --radii NAME          constant, uniform, normal or atomic (default constant)\n"
+    "  --radius R            Constant or mean radius (default 1)\n"
+    "  --radius-spread S     Half-width or deviation of the radii (default 0.2)\n"
+    "  --density D           Points per unit volume (default 1; ignored by protein)\n"
+    "  --seed N              Workload seed (default 1)\n"
+    "  --complex NAME        delaunay, weighted or alpha (default alpha)\n"
+    "  --threads N           Executor threads; 0 runs on the calling thread (default 0)\n"
+    "  --warmup N            Untimed runs first (default 1)\n"
+    "  --repeat N            Timed runs (default 3)\n"
+    "  --output PATH         Write the JSON report to PATH instead of stdout\n"
+    "  --trace PATH          Write a Chrome trace of the last timed run to PATH\n"
+    "  --counters on|off     Count cycles, instructions, cache and branch misses per\n"
+    "                        stage with Linux perf events, if permitted (default off)\n"
+    "  --predicates on|off   Count predicate filter failures and degeneracies after\n"
+    "                        triangulating, outside the stage times (default off)\n"
+    "\n"
+    "--workload, --points, --colors and --threads take comma-separated lists. With\n"
+    "more than one combination, every combination is run and the report lists\n"
+    "median times with speedups and efficiencies against the first thread count.\n";
+
+// "a,b,c" with every item parsed by `parse`
+template<typename Parse>
+auto parse_list(const std::string& text, Parse parse) {
+    std::vector<decltype(parse(text))> values;
+    size_t begin = 0;
+    while (true) {
+        size_t end = text.find(',', begin);
+        std::string item = text.substr(begin, end == std::string::npos ? std::string::npos : end - begin);
+        if (item.empty()) {
+            throw std::invalid_argument("Empty item in list '" + text + "'");
+        }
+        values.push_back(parse(item));
+        if (end == std::string::npos) return values;
+        begin = end + 1;
+    }
+}
+
+Arguments parse_arguments(int argc, char** argv) {
+    std::map<std::string, std::string> values;
+    for (int i = 1; i < argc; ++i) {
+        std::string name = argv[i];
+        if (name == "--help" || name == "-h") {
+            std::cout << kUsage;
+            std::exit(0);
+        }
+        if (name.rfind("--", 0) != 0 || i + 1 >= argc) {
+            throw std::invalid_argument("Expected '--option value', got '" + name + "'");
+        }
+        values[name.substr(2)] = argv[++i];
+    }
+
+    Arguments args;
+    auto take = [&](const std::string& name, auto parse) {
+        auto it = values.find(name);
+        if (it == values.end()) return;
+        parse(it->second);
+        values.erase(it);
+    };
+    auto to_size = [](const std::string& text) { return static_cast<size_t>(std::stod(text)); };
+    auto to_int = [](const std::string& text) { return std::stoi(text); };
+
+    take("workload", [&](const std::string& v) { args.kinds = parse_list(v, parse_workload_kind); });
+    take("points", [&](const std::string& v) { args.points = parse_list(v, to_size); });
+    take("colors", [&](const std::string& v) { args.colors = parse_list(v, to_int); });
+    take("radii", [&](const std::string& v) { args.workload.radii = parse_radii_distribution(v); });
+    take("radius", [&](const std::string& v) { args.workload.radius = std::stod(v); });
+    take("radius-spread", [&](const std::string& v) { args.workload.radius_spread = std::stod(v); });
+    take("density", [&](const std::string& v) { args.workload.density = std::stod(v); });
+    take("seed", [&](const std::string& v) { args.workload.seed = std::stoull(v); });
+    take("complex", [&](const std::string& v) { args.complex = v; });
+    take("threads", [&](const std::string& v) { args.threads = parse_list(v, to_size); });
+    take("warmup", [&](const std::string& v) { args.warmup = to_size(v); });
+    take("repeat", [&](const std::string& v) { args.repeat = std::max<size_t>(1, to_size(v)); });
+    take("output", [&](const std::string& v) { args.output = v; });
+    take("trace", [&](const std::string& v) { args.trace = v; });
+    take("counters", [&](const std::string& v) {
+        if (v != "on" && v != "off") {
+            throw std::invalid_argument("--counters takes 'on' or 'off', got '" + v + "'");
+        }
+        args.run.hardware_counters = v == "on";
+    });
+    take("predicates", [&](const std::string& v) {
+        if (v != "on" && v != "off") {
+            throw std::invalid_argument("--predicates takes 'on' or 'off', got '" + v + "'");
+        }
+        args.run.predicates = v == "on";
+    });
+
+    if (!values.empty()) {
+        throw std::invalid_argument("Unknown option '--" + values.begin()->first + "'");
+    }
+
+    args.workload.kind = args.kinds.front();
+    args.workload.num_points = args.points.front();
+    args.workload.num_colors = args.colors.front();
+    args.run.num_threads = args.threads.front();
+    if (args.sweep() && !args.trace.empty()) {
+        throw std::invalid_argument("--trace needs a single combination");
+    }
+    if (args.sweep() && args.run.hardware_counters) {
+        throw std::invalid_argument("--counters needs a single combination");
+    }
+
+    if (args.complex == "delaunay") {
+        args.run.weighted = false;
+        args.run.alpha = false;
+    } else if (args.complex == "weighted") {
+        args.run.weighted = true;
+        args.run.alpha = false;
+    } else if (args.complex != "alpha") {
+        throw std::invalid_argument("Unknown complex '" + args.complex + "' (delaunay, weighted, alpha)");
+    }
+    return args;
+}
+
+void write_counters(JsonWriter& json, const HardwareCounts& counters) {
+    json.key("counters").begin_object();
+    for (size_t i = 0; i < kNumHardwareEvents; ++i) {
+        auto event = static_cast<HardwareEvent>(i);
+        if (counters.has(event)) json.field(to_string(event), counters.value(event));
+    }
+    json.field("ipc", counters.ipc())
+        .field("cache_miss_rate", counters.cache_miss_rate())
+        .field("branch_miss_rate", counters.branch_miss_rate())
+        .end_object();
+}
+
+void write_stage(JsonWriter& json, const StageResult& stage) {
+    json.begin_object()
+        .field("seconds", stage.seconds)
+        .field("cpu_seconds", stage.cpu_seconds)
+        .field("items", stage.items)
+        .field("items_per_second", stage.seconds > 0 ? stage.items / stage.seconds : 0.0)
+        .field("allocations", stage.allocations)
+        .field("allocated_bytes", stage.allocated_bytes);
+    if (stage.counters.any()) write_counters(json, stage.counters);
+    json.end_object();
+}
+
+void write_counts(JsonWriter& json, const ComputationStats& stats) {
+    json.key("counts").begin_object()
+        .field("points_inserted", stats.points_inserted)
+        .field("hidden_points", stats.hidden_points)
+        .field("finite_cells", stats.finite_cells)
+        .field("multicolored_cells", stats.multicolored_cells);
+    json.key("cells_by_partition").begin_object();
+    for (auto type : {PartitionType::TwoTwo, PartitionType::ThreeOne,
+                      PartitionType::TwoOneOne, PartitionType::OneOneOneOne}) {
+        json.field(to_string(type), stats.cells_by_partition[static_cast<size_t>(type)]);
+    }
+    json.end_object();
+    json.field("simplex_hits", stats.simplex_hits)
+        .field("simplex_misses", stats.simplex_misses);
+    json.key("simplices_by_dimension").begin_array();
+    for (size_t count : stats.simplices_by_dimension) json.value(count);
+    json.end_array();
+    json.key("predicates").begin_object();
+    for (auto [type, name] : {std::pair(PredicateType::Orientation, "orientation"),
+                              std::pair(PredicateType::InSphere, "in_sphere")}) {
+        const auto& predicate = stats.predicates[static_cast<size_t>(type)];
+        json.key(name).begin_object()
+            .field("evaluations", predicate.evaluations)
+            .field("filter_failures", predicate.filter_failures)
+            .field("degenerate", predicate.degenerate)
+            .end_object();
+    }
+    json.end_object();
+    json.end_object();
+}
+
+void write_memory(JsonWriter& json, const MemoryStats& memory) {
+    json.key("memory").begin_object()
+        .field("triangulation_bytes", memory.triangulation_bytes)
+        .field("cells_bytes", memory.cells_bytes)
+        .field("simplex_table_bytes", memory.simplex_table_bytes)
+        .field("filtration_bytes", memory.filtration_bytes)
+        .field("barycenter_bytes", memory.barycenter_bytes)
+        .field("peak_bytes", memory.peak_bytes)
+        .field("peak_rss_bytes", memory.peak_rss_bytes)
+        .end_object();
+}
+
+void write_report(
+    std::ostream& out,
+    const Arguments& args,
+    const Workload& workload,
+    double generation_seconds,
+    const std::vector<RunResult>& runs
+) {
+    JsonWriter json(out);
+    json.begin_object();
+    json.field("benchmark", "compute_interface_surface");
+
+    json.key("config").begin_object()
+        .field("workload", to_string(args.workload.kind))
+        .field("points", args.workload.num_points)
+        .field("colors", args.workload.num_colors)
+        .field("radii", to_string(args.workload.radii))
+        .field("radius", args.workload.radius)
+        .field("radius_spread", args.workload.radius_spread)
+        .field("density", args.workload.density)
+        .field("seed", args.workload.seed)
+        .field("complex", args.complex)
+        .field("threads", args.run.num_threads)
+        .field("hardware_threads", std::thread::hardware_concurrency())
+        .field("allocation_tracking", allocation_tracking_enabled())
+        .field("hardware_counters", args.run.hardware_counters)
+        .field("predicates", args.run.predicates)
+        .field("warmup", args.warmup)
+        .field("repeat", args.repeat)
+        .end_object();
+
+    json.key("workload").begin_object()
+        .field("points", workload.points.size())
+        .field("generation_seconds", generation_seconds)
+        .end_object();
+
+    json.key("runs").begin_array();
+    for (const auto& run : runs) {
+        json.begin_object();
+        json.field("seconds", run.seconds);
+        json.field("points_per_second", workload.points.size() / run.seconds);
+        json.key("stages").begin_object();
+        for (auto stage : all_stages()) {
+            json.key(to_string(stage));
+            write_stage(json, run.stages[static_cast<size_t>(stage)]);
+        }
+        json.end_object();
+        json.key("output").begin_object()
+            .field("vertices", run.vertices)
+            .field("simplices", run.simplices)
+            .end_object();
+        write_counts(json, run.stats);
+        write_memory(json, run.stats.memory);
+        json.end_object();
+    }
+    json.end_array();
+
+    // Medians over the timed runs
+    std::vector<double> totals;
+    for (const auto& run : runs) totals.push_back(run.seconds);
+
+    json.key("summary").begin_object();
+    json.field("median_seconds", median(totals));
+    json.field("min_seconds", *std::min_element(totals.begin(), totals.end()));
+    json.field("points_per_second", workload.points.size() / median(totals));
+    json.key("stages").begin_object();
+    for (auto stage : all_stages()) {
+        std::vector<double> seconds;
+        for (const auto& run : runs) seconds.push_back(run.stages[static_cast<size_t>(stage)].seconds);
+        std::vector<double> cpu_seconds;
+        for (const auto& run : runs) cpu_seconds.push_back(run.stages[static_cast<size_t>(stage)].cpu_seconds);
+        StageResult summary = runs.front().stages[static_cast<size_t>(stage)];
+        summary.seconds = median(seconds);
+        summary.cpu_seconds = median(cpu_seconds);
+        for (size_t i = 0; i < kNumHardwareEvents; ++i) {
+            std::vector<double> counts;
+            for (const auto& run : runs) counts.push_back(run.stages[static_cast<size_t>(stage)].counters.values[i]);
+            summary.counters.values[i] = median(counts);
+        }
+        json.key(to_string(stage));
+        write_stage(json, summary);
+    }
+    json.end_object();
+    json.end_object();
+
+    json.end_object();
+}
+
+void write_sweep_report(std::ostream& out, const Arguments& args, const std::vector<SweepPoint>& points) {
+    JsonWriter json(out);
+    json.begin_object();
+    json.field("benchmark", "sweep");
+
+    json.key("config").begin_object();
+    json.key("workloads").begin_array();
+    for (auto kind : args.kinds) json.value(to_string(kind));
+    json.end_array();
+    json.key("points").begin_array();
+    for (size_t n : args.points) json.value(n);
+    json.end_array();
+    json.key("colors").begin_array();
+    for (int n : args.colors) json.value(n);
+    json.end_array();
+    json.key("threads").begin_array();
+    for (size_t n : args.threads) json.value(n);
+    json.end_array();
+    json.field("radii", to_string(args.workload.radii))
+        .field("radius", args.workload.radius)
+        .field("radius_spread", args.workload.radius_spread)
+        .field("density", args.workload.density)
+        .field("seed", args.workload.seed)
+        .field("complex", args.complex)
+        .field("hardware_threads", std::thread::hardware_concurrency())
+        .field("warmup", args.warmup)
+        .field("repeat", args.repeat)
+        .end_object();
+
+    json.key("sweep").begin_array();
+    for (const auto& point : points) {
+        json.begin_object()
+            .field("workload", to_string(point.workload.kind))
+            .field("points", point.workload.num_points)
+            .field("colors", point.workload.num_colors)
+            .field("threads", point.num_threads)
+            .field("median_seconds", point.seconds)
+            .field("speedup", point.speedup)
+            .field("efficiency", point.efficiency);
+        json.key("stages").begin_object();
+        for (auto stage : all_stages()) {
+            size_t index = static_cast<size_t>(stage);
+            json.key(to_string(stage)).begin_object()
+                .field("seconds", point.stage_seconds[index])
+                .field("speedup", point.stage_speedup[index])
+                .end_object();
+        }
+        json.end_object();
+        write_counts(json, point.stats);
+        json.end_object();
+    }
+    json.end_array();
+
+    json.end_object();
+}
+
+// Writes to --output, or stdout without one
+template<typename Write>
+void write_output(const Arguments& args, Write write) {
+    if (args.output.empty()) {
+        write(std::cout);
+        return;
+    }
+    std::ofstream out(args.output);
+    if (!out) {
+        throw std::runtime_error("Cannot write '" + args.output + "'");
+    }
+    write(out);
+}
+
+void run_sweep(const Arguments& args) {
+    SweepConfig config;
+    config.workload = args.workload;
+    config.run = args.run;
+    config.kinds = args.kinds;
+    config.num_points = args.points;
+    config.num_colors = args.colors;
+    config.num_threads = args.threads;
+    config.warmup = args.warmup;
+    config.repeat = args.repeat;
+
+    auto points = run_sweep(config, std::cerr);
+    write_sweep_table(std::cerr, points);
+    write_output(args, [&](std::ostream& out) { write_sweep_report(out, args, points); });
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    try {
+        Arguments args = parse_arguments(argc, argv);
+        if (args.run.hardware_counters) {
+            PerfCounters probe;
+            if (!probe.available()) {
+                std::cerr << "Hardware counters unavailable, reporting without them: " << probe.error() << "\n";
+                args.run.hardware_counters = false;
+            }
+        }
+        if (args.sweep()) {
+            run_sweep(args);
+            return 0;
+        }
+
+        auto begin = std::chrono::steady_clock::now();
+        Workload workload = generate_workload(args.workload);
+        double generation_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+        for (size_t i = 0; i < args.warmup; ++i) {
+            run_once(workload, args.run);
+        }
+        std::vector<RunResult> runs;
+        TraceRecorder trace;
+        set_trace_thread_name("main");
+        for (size_t i = 0; i < args.repeat; ++i) {
+            bool traced = !args.trace.empty() && i + 1 == args.repeat;
+            runs.push_back(run_once(workload, args.run, traced ? &trace : nullptr));
+            std::cerr << "run " << i + 1 << "/" << args.repeat << ": " << runs.back().seconds << " s\n";
+        }
+
+        if (!args.trace.empty()) {
+            trace.write_chrome_trace(args.trace);
+        }
+        write_output(args, [&](std::ostream& out) {
+            write_report(out, args, workload, generation_seconds, runs);
+        });
+        return 0;
+    } catch (const std::invalid_argument& e) {
+        std::cerr << "Error: " << e.what() << "\n\n" << kUsage;
+        return 1;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+}
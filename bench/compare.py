@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+"""Compare two delaunay_interfaces_bench reports and flag regressions.
+
+    python3 compare.py baseline.json candidate.json --threshold 0.1
+
+Both files must be reports of the same kind: single runs, sweeps, or
+microbenchmarks. Entries are matched by configuration (workload, points,
+colors and threads, or partition type and table state), and the median total
+and per-stage wall times are compared. A time that grew by
+more than the threshold (a fraction, default 0.1) is a regression; stages
+faster than --min-seconds in both reports are too noisy to flag. Differing
+output simplex counts are reported as well. Exits with 1 if anything regressed.
+"""
+
+import argparse
+import json
+import sys
+
+STAGES = ("triangulation", "extraction", "subdivision", "sorting")
+
+
+def load(path):
+    with open(path) as f:
+        return json.load(f)
+
+
+def entries(report):
+    """Map of configuration key -> (total seconds, {stage: seconds}, simplices)."""
+    if report.get("benchmark") == "subdivision_kernels":
+        return {"{} {}".format(kernel["type"], kernel["table"]): (kernel["median_seconds"], {}, kernel["vertices"])
+                for kernel in report["kernels"]}
+
+    if report.get("benchmark") == "sweep":
+        result = {}
+        for point in report["sweep"]:
+            key = "{} points={} colors={} threads={}".format(
+                point["workload"], point["points"], point["colors"], point["threads"])
+            stages = {name: point["stages"][name]["seconds"] for name in STAGES}
+            simplices = sum(point["counts"]["simplices_by_dimension"])
+            result[key] = (point["median_seconds"], stages, simplices)
+        return result
+
+    config = report["config"]
+    key = "{} points={} colors={} threads={}".format(
+        config["workload"], config["points"], config["colors"], config["threads"])
+    summary = report["summary"]
+    stages = {name: summary["stages"][name]["seconds"] for name in STAGES}
+    simplices = report["runs"][0]["output"]["simplices"] if report["runs"] else None
+    return {key: (summary["median_seconds"], stages, simplices)}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("baseline")
+    parser.add_argument("candidate")
+    parser.add_argument("--threshold", type=float, default=0.1,
+                        help="Relative slowdown that counts as a regression (default 0.1)")
+    parser.add_argument("--min-seconds", type=float, default=1e-3,
+                        help="Ignore stages below this time in both reports (default 0.001)")
+    args = parser.parse_args()
+
+    baseline_report = load(args.baseline)
+    candidate_report = load(args.candidate)
+    if baseline_report.get("benchmark") != candidate_report.get("benchmark"):
+        sys.exit("Cannot compare reports of different kinds")
+    baseline = entries(baseline_report)
+    candidate = entries(candidate_report)
+
+    regressions = 0
+    print("{:<45} {:<14} {:>11} {:>11} {:>8}".format("configuration", "stage", "baseline", "candidate", "change"))
+    for key in sorted(set(baseline) | set(candidate)):
+        if key not in baseline or key not in candidate:
+            print("{:<45} only in {}".format(key, "candidate" if key in candidate else "baseline"))
+            continue
+
+        base_total, base_stages, base_simplices = baseline[key]
+        cand_total, cand_stages, cand_simplices = candidate[key]
+        rows = [("total", base_total, cand_total)]
+        rows += [(name, base_stages[name], cand_stages[name]) for name in STAGES if name in base_stages]
+        for stage, before, after in rows:
+            change = (after - before) / before if before > 0 else 0.0
+            noisy = before < args.min_seconds and after < args.min_seconds
+            regressed = change > args.threshold and not noisy
+            regressions += regressed
+            print("{:<45} {:<14} {:>11.4f} {:>11.4f} {:>+7.1%}{}".format(
+                key, stage, before, after, change, "  REGRESSION" if regressed else ""))
+        if base_simplices != cand_simplices:
+            print("{:<45} output differs: {} vs {} simplices".format(key, base_simplices, cand_simplices))
+
+    if regressions:
+        print("\n{} regression(s) above {:.0%}".format(regressions, args.threshold))
+        return 1
+    print("\nNo regressions above {:.0%}".format(args.threshold))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,101 @@
+#include "harness.hpp"
+#include <delaunay_interfaces/interface_generation.hpp>
+#include <delaunay_interfaces/thread_pool.hpp>
+#include <algorithm>
+#include <chrono>
+#include <optional>
+
+namespace delaunay_interfaces {
+namespace bench {
+
+const std::array<ComputationStage, kNumStages>& all_stages() {
+    static const std::array<ComputationStage, kNumStages> stages = {
+        ComputationStage::Triangulation,
+        ComputationStage::Extraction,
+        ComputationStage::Subdivision,
+        ComputationStage::Sorting
+    };
+    return stages;
+}
+
+std::string to_string(ComputationStage stage) {
+    switch (stage) {
+        case ComputationStage::Triangulation: return "triangulation";
+        case ComputationStage::Extraction: return "extraction";
+        case ComputationStage::Subdivision: return "subdivision";
+        case ComputationStage::Sorting: return "sorting";
+    }
+    return "unknown";
+}
+
+namespace {
+
+// Makes `observer` the stage observer for its lifetime
+class ObserverScope {
+public:
+    explicit ObserverScope(StageObserver* observer) : previous_(get_stage_observer()) {
+        set_stage_observer(observer);
+    }
+    ~ObserverScope() { set_stage_observer(previous_); }
+
+    ObserverScope(const ObserverScope&) = delete;
+    ObserverScope& operator=(const ObserverScope&) = delete;
+
+private:
+    StageObserver* previous_;
+};
+
+} // namespace
+
+double median(std::vector<double> values) {
+    if (values.empty()) return 0;
+    std::sort(values.begin(), values.end());
+    size_t n = values.size();
+    return n % 2 ? values[n / 2] : 0.5 * (values[n / 2 - 1] + values[n / 2]);
+}
+
+RunResult run_once(const Workload& workload, const RunConfig& config, TraceRecorder* trace) {
+    TraceScope tracing(trace);
+    // Opened before the pool so its workers inherit the counters
+    std::optional<PerfCounters> counters;
+    if (config.hardware_counters) counters.emplace();
+    ObserverScope observing(counters && counters->available() ? &*counters : nullptr);
+
+    InterfaceGenerator generator;
+    StatsOptions stats_options;
+    stats_options.enabled = true;
+    stats_options.memory = true;
+    stats_options.predicates = config.predicates;
+    generator.set_stats_options(stats_options);
+    if (config.num_threads > 0) {
+        generator.set_executor(std::make_shared<ThreadPool>(config.num_threads));
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    auto surface = generator.compute_interface_surface(
+        workload.points, workload.color_labels, workload.radii, config.weighted, config.alpha);
+    auto end = std::chrono::steady_clock::now();
+
+    const auto& stats = *surface.stats;
+    const std::array<size_t, kNumStages> items = {
+        stats.points_inserted, stats.finite_cells, stats.multicolored_cells, surface.filtration.size()
+    };
+
+    RunResult result;
+    result.seconds = std::chrono::duration<double>(end - begin).count();
+    for (auto stage : all_stages()) {
+        size_t index = static_cast<size_t>(stage);
+        const auto& timing = stats.stage(stage);
+        result.stages[index] = StageResult{
+            timing.wall_seconds, timing.cpu_seconds, items[index], timing.allocations, timing.allocated_bytes,
+            counters && counters->available() ? counters->stage_counts(stage) : HardwareCounts{}
+        };
+    }
+    result.stats = stats;
+    result.vertices = surface.vertices.size();
+    result.simplices = surface.filtration.size();
+    return result;
+}
+
+} // namespace bench
+} // namespace delaunay_interfaces
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "perf_counters.hpp"
+#include "workloads.hpp"
+#include <delaunay_interfaces/stats.hpp>
+#include <delaunay_interfaces/trace.hpp>
+#include <array>
+#include <string>
+#include <vector>
+
+namespace delaunay_interfaces {
+namespace bench {
+
+constexpr size_t kNumStages = 4;
+
+// Stages in pipeline order, as named in reports
+const std::array<ComputationStage, kNumStages>& all_stages();
+std::string to_string(ComputationStage stage);
+
+struct RunConfig {
+    bool weighted = true;
+    bool alpha = true;
+    size_t num_threads = 0;  // 0 = no executor, everything on the calling thread
+    bool hardware_counters = false;  // Count hardware events per stage where perf events allow
+    bool predicates = false;         // Count predicate filter failures in an untimed extra pass
+};
+
+struct StageResult {
+    double seconds = 0;      // Wall time
+    double cpu_seconds = 0;  // Process CPU time
+    size_t items = 0;        // Points, cells, multicolored cells, simplices
+    size_t allocations = 0;  // Only counted with TRACK_ALLOCATIONS
+    size_t allocated_bytes = 0;
+    HardwareCounts counters;  // Nothing counted without hardware_counters
+};
+
+struct RunResult {
+    double seconds = 0;
+    std::array<StageResult, kNumStages> stages;
+    ComputationStats stats;
+    size_t vertices = 0;
+    size_t simplices = 0;
+};
+
+double median(std::vector<double> values);
+
+// Computes the interface surface of `workload` once and times its stages,
+// tracing the run into `trace` if given
+RunResult run_once(const Workload& workload, const RunConfig& config, TraceRecorder* trace = nullptr);
+
+} // namespace bench
+} // namespace delaunay_interfaces
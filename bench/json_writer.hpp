@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cmath>
+#include <iomanip>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace delaunay_interfaces {
+namespace bench {
+
+// Minimal streaming JSON writer for benchmark reports. Keys and values are
+// written in call order; commas and indentation are handled here.
+class JsonWriter {
+public:
+    explicit JsonWriter(std::ostream& out) : out_(out) {
+        out_ << std::setprecision(9);
+    }
+
+    JsonWriter& begin_object() { open('{'); return *this; }
+    JsonWriter& end_object() { close('}'); return *this; }
+    JsonWriter& begin_array() { open('['); return *this; }
+    JsonWriter& end_array() { close(']'); return *this; }
+
+    JsonWriter& key(const std::string& name) {
+        separate();
+        write_string(name);
+        out_ << ": ";
+        after_key_ = true;
+        return *this;
+    }
+
+    JsonWriter& value(const std::string& text) { separate(); write_string(text); return *this; }
+    JsonWriter& value(const char* text) { return value(std::string(text)); }
+    JsonWriter& value(bool flag) { separate(); out_ << (flag ? "true" : "false"); return *this; }
+    template<typename T, typename = std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>>>
+    JsonWriter& value(T number) { separate(); out_ << number; return *this; }
+    JsonWriter& value(double number) {
+        separate();
+        if (std::isfinite(number)) out_ << number; else out_ << "null";
+        return *this;
+    }
+
+    template<typename T>
+    JsonWriter& field(const std::string& name, const T& field_value) {
+        return key(name).value(field_value);
+    }
+
+private:
+    void open(char bracket) {
+        separate();
+        out_ << bracket;
+        first_.push_back(true);
+    }
+
+    void close(char bracket) {
+        bool empty = first_.back();
+        first_.pop_back();
+        if (!empty) newline();
+        out_ << bracket;
+        if (first_.empty()) out_ << '\n';
+    }
+
+    // Comma and line break before every item except a key's value
+    void separate() {
+        if (after_key_) {
+            after_key_ = false;
+            return;
+        }
+        if (first_.empty()) return;
+        if (!first_.back()) out_ << ',';
+        first_.back() = false;
+        newline();
+    }
+
+    void newline() {
+        out_ << '\n' << std::string(2 * first_.size(), ' ');
+    }
+
+    void write_string(const std::string& text) {
+        out_ << '"';
+        for (char c : text) {
+            switch (c) {
+                case '"': out_ << "\\\""; break;
+                case '\\': out_ << "\\\\"; break;
+                case '\n': out_ << "\\n"; break;
+                case '\t': out_ << "\\t"; break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20) {
+                        out_ << "\\u" << std::hex << std::setw(4) << std::setfill('0') << int(c)
+                             << std::dec << std::setfill(' ');
+                    } else {
+                        out_ << c;
+                    }
+            }
+        }
+        out_ << '"';
+    }
+
+    std::ostream& out_;
+    std::vector<bool> first_;  // Per open container: no item written yet
+    bool after_key_ = false;
+};
+
+} // namespace bench
+} // namespace delaunay_interfaces
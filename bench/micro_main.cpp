@@ -0,0 +1,176 @@
+// Microbenchmarks of BarycentricSubdivision: feeds tetrahedra of one
+// partition type through process_tetrahedron, without a triangulation.
+// A cold table starts empty, so every simplex is created; a hot table has
+// seen the same tetrahedra before, so every simplex is found.
+//
+//   delaunay_interfaces_microbench --tetrahedra 100000 --types 2-2,1-1-1-1 --output micro.json
+
+#include "harness.hpp"
+#include "json_writer.hpp"
+#include "workloads.hpp"
+#include <delaunay_interfaces/barycentric_subdivision.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace delaunay_interfaces;
+using namespace delaunay_interfaces::bench;
+
+namespace {
+
+struct Arguments {
+    size_t tetrahedra = 100000;
+    std::vector<PartitionType> types = {
+        PartitionType::TwoTwo, PartitionType::ThreeOne, PartitionType::TwoOneOne, PartitionType::OneOneOneOne
+    };
+    uint64_t seed = 1;
+    size_t repeat = 5;
+    std::string output;  // Empty = stdout
+};
+
+const char* kUsage =
+    "Usage: delaunay_interfaces_microbench [options]\n"
+    "  --tetrahedra N        Tetrahedra per run (default 100000)\n"
+    "  --types LIST          Comma-separated partition types (default 2-2,3-1,2-1-1,1-1-1-1)\n"
+    "  --seed N              Seed of the tetrahedra (default 1)\n"
+    "  --repeat N            Timed runs per type and table state (default 5)\n"
+    "  --output PATH         Write the JSON report to PATH instead of stdout\n";
+
+Arguments parse_arguments(int argc, char** argv) {
+    Arguments args;
+    for (int i = 1; i < argc; ++i) {
+        std::string name = argv[i];
+        if (name == "--help" || name == "-h") {
+            std::cout << kUsage;
+            std::exit(0);
+        }
+        if (name.rfind("--", 0) != 0 || i + 1 >= argc) {
+            throw std::invalid_argument("Expected '--option value', got '" + name + "'");
+        }
+        std::string value = argv[++i];
+
+        if (name == "--tetrahedra") {
+            args.tetrahedra = static_cast<size_t>(std::stod(value));
+        } else if (name == "--types") {
+            args.types.clear();
+            size_t begin = 0;
+            while (begin <= value.size()) {
+                size_t end = std::min(value.find(',', begin), value.size());
+                args.types.push_back(parse_partition_type(value.substr(begin, end - begin)));
+                begin = end + 1;
+            }
+        } else if (name == "--seed") {
+            args.seed = std::stoull(value);
+        } else if (name == "--repeat") {
+            args.repeat = std::max<size_t>(1, static_cast<size_t>(std::stod(value)));
+        } else if (name == "--output") {
+            args.output = value;
+        } else {
+            throw std::invalid_argument("Unknown option '" + name + "'");
+        }
+    }
+    return args;
+}
+
+struct KernelResult {
+    PartitionType type;
+    bool hot;
+    double seconds;  // Median
+    BarycentricSubdivision::Counters counters;  // Of the timed pass
+    size_t simplices;
+};
+
+KernelResult measure(const TetrahedraWorkload& workload, PartitionType type, bool hot, size_t repeat) {
+    std::vector<double> seconds;
+    KernelResult result{type, hot, 0, {}, 0};
+    for (size_t r = 0; r < repeat; ++r) {
+        BarycentricSubdivision subdivision(workload.points, workload.color_labels);
+        if (hot) {
+            for (const auto& tet : workload.tetrahedra) subdivision.process_tetrahedron(tet);
+        }
+        auto before = subdivision.get_counters();
+
+        auto begin = std::chrono::steady_clock::now();
+        for (const auto& tet : workload.tetrahedra) {
+            subdivision.process_tetrahedron(tet);
+        }
+        seconds.push_back(std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count());
+
+        const auto& after = subdivision.get_counters();
+        for (size_t i = 0; i < after.cells_by_partition.size(); ++i) {
+            result.counters.cells_by_partition[i] = after.cells_by_partition[i] - before.cells_by_partition[i];
+        }
+        result.counters.simplex_hits = after.simplex_hits - before.simplex_hits;
+        result.counters.simplex_misses = after.simplex_misses - before.simplex_misses;
+        result.simplices = subdivision.get_barycenters().size();
+    }
+    result.seconds = median(seconds);
+    return result;
+}
+
+void write_report(std::ostream& out, const Arguments& args, const std::vector<KernelResult>& results) {
+    JsonWriter json(out);
+    json.begin_object();
+    json.field("benchmark", "subdivision_kernels");
+    json.key("config").begin_object()
+        .field("tetrahedra", args.tetrahedra)
+        .field("seed", args.seed)
+        .field("repeat", args.repeat)
+        .end_object();
+
+    json.key("kernels").begin_array();
+    for (const auto& result : results) {
+        json.begin_object()
+            .field("type", to_string(result.type))
+            .field("table", result.hot ? "hot" : "cold")
+            .field("median_seconds", result.seconds)
+            .field("ns_per_tetrahedron", 1e9 * result.seconds / std::max<size_t>(1, args.tetrahedra))
+            .field("simplex_hits", result.counters.simplex_hits)
+            .field("simplex_misses", result.counters.simplex_misses)
+            .field("vertices", result.simplices)
+            .end_object();
+    }
+    json.end_array();
+    json.end_object();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    try {
+        Arguments args = parse_arguments(argc, argv);
+
+        std::vector<KernelResult> results;
+        for (auto type : args.types) {
+            TetrahedraWorkload workload = generate_partition_tetrahedra(type, args.tetrahedra, args.seed);
+            for (bool hot : {false, true}) {
+                results.push_back(measure(workload, type, hot, args.repeat));
+                std::cerr << to_string(type) << (hot ? " hot:  " : " cold: ")
+                          << 1e9 * results.back().seconds / std::max<size_t>(1, args.tetrahedra)
+                          << " ns per tetrahedron\n";
+            }
+        }
+
+        if (args.output.empty()) {
+            write_report(std::cout, args, results);
+        } else {
+            std::ofstream out(args.output);
+            if (!out) {
+                throw std::runtime_error("Cannot write '" + args.output + "'");
+            }
+            write_report(out, args, results);
+        }
+        return 0;
+    } catch (const std::invalid_argument& e) {
+        std::cerr << "Error: " << e.what() << "\n\n" << kUsage;
+        return 1;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+}
@@ -0,0 +1,157 @@
+#include "perf_counters.hpp"
+#include <cerrno>
+#include <cstring>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace delaunay_interfaces {
+namespace bench {
+
+std::string to_string(HardwareEvent event) {
+    switch (event) {
+        case HardwareEvent::Cycles: return "cycles";
+        case HardwareEvent::Instructions: return "instructions";
+        case HardwareEvent::CacheReferences: return "cache_references";
+        case HardwareEvent::CacheMisses: return "cache_misses";
+        case HardwareEvent::Branches: return "branches";
+        case HardwareEvent::BranchMisses: return "branch_misses";
+    }
+    return "unknown";
+}
+
+bool HardwareCounts::any() const {
+    for (bool flag : counted) {
+        if (flag) return true;
+    }
+    return false;
+}
+
+namespace {
+
+double ratio(const HardwareCounts& counts, HardwareEvent numerator, HardwareEvent denominator) {
+    if (!counts.has(numerator) || !counts.has(denominator) || counts.value(denominator) <= 0) return 0;
+    return counts.value(numerator) / counts.value(denominator);
+}
+
+#ifdef __linux__
+int open_counter(HardwareEvent event) {
+    static const uint64_t configs[kNumHardwareEvents] = {
+        PERF_COUNT_HW_CPU_CYCLES,
+        PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_REFERENCES,
+        PERF_COUNT_HW_CACHE_MISSES,
+        PERF_COUNT_HW_BRANCH_INSTRUCTIONS,
+        PERF_COUNT_HW_BRANCH_MISSES
+    };
+
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = configs[static_cast<size_t>(event)];
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    attr.inherit = 1;         // Threads started later
+    attr.exclude_kernel = 1;  // Allowed up to perf_event_paranoid 2
+    attr.exclude_hv = 1;
+    // This thread on any CPU; counting starts right away
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+}
+#endif
+
+} // namespace
+
+double HardwareCounts::ipc() const {
+    return ratio(*this, HardwareEvent::Instructions, HardwareEvent::Cycles);
+}
+
+double HardwareCounts::cache_miss_rate() const {
+    return ratio(*this, HardwareEvent::CacheMisses, HardwareEvent::CacheReferences);
+}
+
+double HardwareCounts::branch_miss_rate() const {
+    return ratio(*this, HardwareEvent::BranchMisses, HardwareEvent::Branches);
+}
+
+PerfCounters::PerfCounters() {
+    fds_.fill(-1);
+#ifdef __linux__
+    int first_error = 0;
+    for (size_t i = 0; i < kNumHardwareEvents; ++i) {
+        fds_[i] = open_counter(static_cast<HardwareEvent>(i));
+        if (fds_[i] >= 0) {
+            available_ = true;
+        } else if (!first_error) {
+            first_error = errno;
+        }
+    }
+    if (!available_) {
+        error_ = "perf_event_open failed: " + std::string(std::strerror(first_error));
+        if (first_error == EACCES || first_error == EPERM) {
+            error_ += " (see /proc/sys/kernel/perf_event_paranoid)";
+        }
+    }
+#else
+    error_ = "hardware counters need Linux perf events";
+#endif
+}
+
+PerfCounters::~PerfCounters() {
+#ifdef __linux__
+    for (int fd : fds_) {
+        if (fd >= 0) close(fd);
+    }
+#endif
+}
+
+std::array<double, kNumHardwareEvents> PerfCounters::read_totals() const {
+    std::array<double, kNumHardwareEvents> totals = {};
+#ifdef __linux__
+    for (size_t i = 0; i < kNumHardwareEvents; ++i) {
+        if (fds_[i] < 0) continue;
+        // value, time enabled, time running
+        uint64_t values[3] = {};
+        if (read(fds_[i], values, sizeof(values)) != static_cast<ssize_t>(sizeof(values)) || values[2] == 0) {
+            continue;
+        }
+        totals[i] = static_cast<double>(values[0]) * values[1] / values[2];
+    }
+#endif
+    return totals;
+}
+
+void PerfCounters::stage_started(ComputationStage stage) {
+    if (!available_) return;
+    size_t index = static_cast<size_t>(stage);
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (active_[index]++ == 0) {
+        started_[index] = read_totals();
+    }
+}
+
+void PerfCounters::stage_stopped(ComputationStage stage) {
+    if (!available_) return;
+    size_t index = static_cast<size_t>(stage);
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (active_[index] == 0 || --active_[index] > 0) return;
+    auto totals = read_totals();
+    for (size_t i = 0; i < kNumHardwareEvents; ++i) {
+        counts_[index][i] += totals[i] - started_[index][i];
+    }
+}
+
+HardwareCounts PerfCounters::stage_counts(ComputationStage stage) const {
+    HardwareCounts counts;
+    std::lock_guard<std::mutex> lock(mutex_);
+    counts.values = counts_[static_cast<size_t>(stage)];
+    for (size_t i = 0; i < kNumHardwareEvents; ++i) {
+        counts.counted[i] = fds_[i] >= 0;
+    }
+    return counts;
+}
+
+} // namespace bench
+} // namespace delaunay_interfaces
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <delaunay_interfaces/stats.hpp>
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+namespace delaunay_interfaces {
+namespace bench {
+
+// Hardware events counted per stage, in report order
+enum class HardwareEvent { Cycles, Instructions, CacheReferences, CacheMisses, Branches, BranchMisses };
+constexpr size_t kNumHardwareEvents = 6;
+
+std::string to_string(HardwareEvent event);
+
+struct HardwareCounts {
+    std::array<double, kNumHardwareEvents> values = {};
+    std::array<bool, kNumHardwareEvents> counted = {};  // Events the CPU and kernel let us count
+
+    double value(HardwareEvent event) const { return values[static_cast<size_t>(event)]; }
+    bool has(HardwareEvent event) const { return counted[static_cast<size_t>(event)]; }
+    bool any() const;
+
+    // Instructions per cycle, and misses per reference or branch; 0 unless
+    // both events were counted
+    double ipc() const;
+    double cache_miss_rate() const;
+    double branch_miss_rate() const;
+};
+
+// Counts hardware events with perf_event_open (Linux only) for the calling
+// thread and the threads it starts afterwards, so it must be created before
+// any thread pool whose work should be counted. As the stage observer, it
+// adds the counts between each stage's start and stop to that stage; counts
+// of overlapping stages include each other's work.
+//
+// Containers and systems with a restrictive kernel.perf_event_paranoid
+// usually refuse the counters; available() is then false and every stage
+// reports nothing counted.
+class PerfCounters : public StageObserver {
+public:
+    PerfCounters();
+    ~PerfCounters() override;
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    bool available() const { return available_; }
+    // Why no event could be counted; empty if available
+    const std::string& error() const { return error_; }
+
+    void stage_started(ComputationStage stage) override;
+    void stage_stopped(ComputationStage stage) override;
+
+    HardwareCounts stage_counts(ComputationStage stage) const;
+
+private:
+    // Running totals, scaled up for the time an event was multiplexed out
+    std::array<double, kNumHardwareEvents> read_totals() const;
+
+    std::array<int, kNumHardwareEvents> fds_;
+    bool available_ = false;
+    std::string error_;
+
+    mutable std::mutex mutex_;
+    std::array<size_t, 4> active_ = {};  // Open StageClocks per stage
+    std::array<std::array<double, kNumHardwareEvents>, 4> started_ = {};
+    std::array<std::array<double, kNumHardwareEvents>, 4> counts_ = {};
+};
+
+} // namespace bench
+} // namespace delaunay_interfaces
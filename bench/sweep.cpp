@@ -0,0 +1,113 @@
+#include "sweep.hpp"
+#include <algorithm>
+#include <iomanip>
+#include <ostream>
+
+namespace delaunay_interfaces {
+namespace bench {
+
+namespace {
+
+// Runs without an executor use the calling thread
+double effective_threads(size_t num_threads) {
+    return static_cast<double>(std::max<size_t>(1, num_threads));
+}
+
+SweepPoint measure(const Workload& workload, const WorkloadOptions& options, const SweepConfig& config,
+                   size_t num_threads) {
+    RunConfig run = config.run;
+    run.num_threads = num_threads;
+    for (size_t i = 0; i < config.warmup; ++i) {
+        run_once(workload, run);
+    }
+
+    std::vector<double> seconds;
+    std::array<std::vector<double>, kNumStages> stage_seconds;
+    SweepPoint point;
+    for (size_t i = 0; i < std::max<size_t>(1, config.repeat); ++i) {
+        RunResult result = run_once(workload, run);
+        seconds.push_back(result.seconds);
+        for (size_t s = 0; s < kNumStages; ++s) {
+            stage_seconds[s].push_back(result.stages[s].seconds);
+        }
+        point.stats = result.stats;
+    }
+
+    point.workload = options;
+    point.num_threads = num_threads;
+    point.seconds = median(seconds);
+    for (size_t s = 0; s < kNumStages; ++s) {
+        point.stage_seconds[s] = median(stage_seconds[s]);
+    }
+    return point;
+}
+
+double ratio(double baseline, double value) {
+    return value > 0 ? baseline / value : 0.0;
+}
+
+} // namespace
+
+std::vector<SweepPoint> run_sweep(const SweepConfig& config, std::ostream& log) {
+    std::vector<SweepPoint> points;
+    for (auto kind : config.kinds) {
+        for (size_t num_points : config.num_points) {
+            for (int num_colors : config.num_colors) {
+                WorkloadOptions options = config.workload;
+                options.kind = kind;
+                options.num_points = num_points;
+                options.num_colors = num_colors;
+                Workload workload = generate_workload(options);
+
+                const size_t baseline = points.size();
+                for (size_t num_threads : config.num_threads) {
+                    SweepPoint point = measure(workload, options, config, num_threads);
+                    const SweepPoint& base = baseline < points.size() ? points[baseline] : point;
+
+                    point.speedup = ratio(base.seconds, point.seconds);
+                    for (size_t s = 0; s < kNumStages; ++s) {
+                        point.stage_speedup[s] = ratio(base.stage_seconds[s], point.stage_seconds[s]);
+                    }
+                    point.efficiency = point.speedup * effective_threads(base.num_threads) /
+                                       effective_threads(num_threads);
+                    log << to_string(kind) << " " << num_points << " points, " << num_colors << " colors, "
+                        << num_threads << " threads: " << point.seconds << " s\n";
+                    points.push_back(point);
+                }
+            }
+        }
+    }
+    return points;
+}
+
+void write_sweep_table(std::ostream& out, const std::vector<SweepPoint>& points) {
+    std::ios_base::fmtflags flags = out.flags();
+    std::streamsize precision = out.precision();
+    out << std::left << std::setw(10) << "workload" << std::right
+        << std::setw(11) << "points" << std::setw(7) << "colors" << std::setw(8) << "threads"
+        << std::setw(11) << "seconds" << std::setw(9) << "speedup" << std::setw(11) << "efficiency";
+    for (auto stage : all_stages()) {
+        out << std::setw(15) << to_string(stage);
+    }
+    out << "\n";
+
+    out << std::fixed;
+    for (const auto& point : points) {
+        out << std::left << std::setw(10) << to_string(point.workload.kind) << std::right
+            << std::setw(11) << point.workload.num_points << std::setw(7) << point.workload.num_colors
+            << std::setw(8) << point.num_threads
+            << std::setw(11) << std::setprecision(4) << point.seconds
+            << std::setw(9) << std::setprecision(2) << point.speedup
+            << std::setw(11) << point.efficiency;
+        // Stage speedups
+        for (double speedup : point.stage_speedup) {
+            out << std::setw(15) << speedup;
+        }
+        out << "\n";
+    }
+    out.flags(flags);
+    out.precision(precision);
+}
+
+} // namespace bench
+} // namespace delaunay_interfaces
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "harness.hpp"
+#include <iosfwd>
+#include <vector>
+
+namespace delaunay_interfaces {
+namespace bench {
+
+// Every combination of the lists is run; the remaining workload options
+// (radii, density, seed) come from `workload`
+struct SweepConfig {
+    WorkloadOptions workload;
+    RunConfig run;
+    std::vector<WorkloadKind> kinds;
+    std::vector<size_t> num_points;
+    std::vector<int> num_colors;
+    std::vector<size_t> num_threads;  // The first is the baseline of speedups
+    size_t warmup = 1;
+    size_t repeat = 3;
+};
+
+struct SweepPoint {
+    WorkloadOptions workload;
+    size_t num_threads = 0;
+    double seconds = 0;                                // Median over the timed runs
+    std::array<double, kNumStages> stage_seconds = {};  // Medians
+    // Against the baseline thread count on the same workload
+    double speedup = 1;
+    std::array<double, kNumStages> stage_speedup = {};
+    double efficiency = 1;  // Speedup per thread added over the baseline
+    ComputationStats stats;  // Of the last run
+};
+
+// Workloads are generated once and run at every thread count in turn
+std::vector<SweepPoint> run_sweep(const SweepConfig& config, std::ostream& log);
+
+// Fixed-width table of times, speedups and efficiencies, one row per point
+void write_sweep_table(std::ostream& out, const std::vector<SweepPoint>& points);
+
+} // namespace bench
+} // namespace delaunay_interfaces
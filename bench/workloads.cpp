@@ -0,0 +1,266 @@
+#include "workloads.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+
+namespace delaunay_interfaces {
+namespace bench {
+
+namespace {
+
+constexpr double kPi = 3.14159265358979323846;
+
+// std::mt19937_64 output is fixed by the standard, unlike the std distributions
+class Random {
+public:
+    explicit Random(uint64_t seed) : engine_(seed) {}
+
+    double uniform() { return (engine_() >> 11) * 0x1.0p-53; }
+    double uniform(double low, double high) { return low + (high - low) * uniform(); }
+    size_t index(size_t size) { return static_cast<size_t>(uniform() * size) % size; }
+
+    double normal() {
+        // Box-Muller; 1 - u avoids log(0)
+        double u = 1.0 - uniform();
+        double v = uniform();
+        return std::sqrt(-2.0 * std::log(u)) * std::cos(2.0 * kPi * v);
+    }
+
+    Point3D normal_point(const Point3D& center, double sigma) {
+        return center + sigma * Point3D(normal(), normal(), normal());
+    }
+
+    Point3D unit_vector() {
+        Point3D v(normal(), normal(), normal());
+        double norm = v.norm();
+        return norm > 0 ? Point3D(v / norm) : Point3D(1.0, 0.0, 0.0);
+    }
+
+private:
+    std::mt19937_64 engine_;
+};
+
+double cube_side(const WorkloadOptions& options) {
+    return std::cbrt(options.num_points / options.density);
+}
+
+void generate_uniform(const WorkloadOptions& options, Random& random, Workload& workload) {
+    const double side = cube_side(options);
+    for (size_t i = 0; i < options.num_points; ++i) {
+        workload.points.emplace_back(random.uniform(0, side), random.uniform(0, side), random.uniform(0, side));
+        workload.color_labels.push_back(static_cast<int>(random.index(options.num_colors)));
+    }
+}
+
+void generate_clustered(const WorkloadOptions& options, Random& random, Workload& workload) {
+    const double side = cube_side(options);
+    const size_t num_clusters = 4 * options.num_colors;
+    // Neighboring blobs overlap by about a standard deviation
+    const double sigma = 0.5 * side / std::cbrt(static_cast<double>(num_clusters));
+
+    Points centers;
+    for (size_t c = 0; c < num_clusters; ++c) {
+        centers.emplace_back(random.uniform(0, side), random.uniform(0, side), random.uniform(0, side));
+    }
+    for (size_t i = 0; i < options.num_points; ++i) {
+        size_t cluster = random.index(num_clusters);
+        workload.points.push_back(random.normal_point(centers[cluster], sigma));
+        workload.color_labels.push_back(static_cast<int>(cluster % options.num_colors));
+    }
+}
+
+void generate_layered(const WorkloadOptions& options, Random& random, Workload& workload) {
+    const double side = cube_side(options);
+    const double thickness = side / options.num_colors;
+    const double amplitude = 0.2 * thickness;
+    const double wavelength = 0.5 * side;
+
+    for (size_t i = 0; i < options.num_points; ++i) {
+        Point3D p(random.uniform(0, side), random.uniform(0, side), random.uniform(0, side));
+        double offset = amplitude * std::sin(2 * kPi * p.x() / wavelength) * std::sin(2 * kPi * p.y() / wavelength);
+        int layer = static_cast<int>(std::floor((p.z() + offset) / thickness));
+        workload.points.push_back(p);
+        workload.color_labels.push_back(std::clamp(layer, 0, options.num_colors - 1));
+    }
+}
+
+// Chains of residues (a C-alpha random walk with persistent direction, 3.8 A
+// steps) confined to a sphere at protein atom density, with side chain atoms
+// scattered around each C-alpha. Chains are colored round robin.
+void generate_protein_like(const WorkloadOptions& options, Random& random, Workload& workload) {
+    constexpr size_t kAtomsPerResidue = 8;
+    constexpr size_t kResiduesPerChain = 150;
+    constexpr double kBondLength = 3.8;
+    constexpr double kAtomDensity = 0.05;  // Atoms per cubic Angstrom in folded proteins
+    constexpr double kAtomSpread = 1.3;
+
+    const size_t num_residues = (options.num_points + kAtomsPerResidue - 1) / kAtomsPerResidue;
+    const size_t num_chains = std::max<size_t>(options.num_colors, num_residues / kResiduesPerChain);
+    const double sphere_radius = std::cbrt(3.0 * options.num_points / (4.0 * kPi * kAtomDensity));
+
+    size_t residue = 0;
+    for (size_t chain = 0; chain < num_chains && residue < num_residues; ++chain) {
+        const size_t chain_end = (chain + 1) * num_residues / num_chains;
+        const int color = static_cast<int>(chain % options.num_colors);
+
+        Point3D position = random.unit_vector() * (sphere_radius * std::cbrt(random.uniform()));
+        Point3D direction = random.unit_vector();
+        for (; residue < chain_end; ++residue) {
+            direction = (direction + 0.8 * random.unit_vector()).normalized();
+            // Turn inwards near the surface to keep the fold compact
+            if ((position + kBondLength * direction).norm() > sphere_radius) {
+                direction = (direction - 1.5 * position.normalized()).normalized();
+            }
+            position += kBondLength * direction;
+
+            for (size_t a = 0; a < kAtomsPerResidue && workload.points.size() < options.num_points; ++a) {
+                workload.points.push_back(a == 0 ? position : random.normal_point(position, kAtomSpread));
+                workload.color_labels.push_back(color);
+            }
+        }
+    }
+}
+
+double sample_radius(const WorkloadOptions& options, Random& random) {
+    switch (options.radii) {
+        case RadiiDistribution::Constant:
+            return options.radius;
+        case RadiiDistribution::Uniform:
+            return random.uniform(options.radius - options.radius_spread, options.radius + options.radius_spread);
+        case RadiiDistribution::Normal:
+            return std::max(0.1 * options.radius, options.radius + options.radius_spread * random.normal());
+        case RadiiDistribution::Atomic: {
+            double u = random.uniform();
+            if (u < 0.60) return 1.70;  // C
+            if (u < 0.76) return 1.55;  // N
+            if (u < 0.96) return 1.52;  // O
+            return 1.80;                // S
+        }
+    }
+    return options.radius;
+}
+
+} // namespace
+
+Workload generate_workload(const WorkloadOptions& options) {
+    if (options.num_colors < 1) {
+        throw std::invalid_argument("A workload needs at least one color");
+    }
+    if (!(options.density > 0)) {
+        throw std::invalid_argument("Workload density must be positive");
+    }
+    if (options.radii == RadiiDistribution::Uniform && options.radius_spread > options.radius) {
+        throw std::invalid_argument("Uniform radii need radius_spread <= radius");
+    }
+
+    Random random(options.seed);
+    Workload workload;
+    workload.points.reserve(options.num_points);
+    workload.color_labels.reserve(options.num_points);
+
+    switch (options.kind) {
+        case WorkloadKind::Uniform: generate_uniform(options, random, workload); break;
+        case WorkloadKind::Clustered: generate_clustered(options, random, workload); break;
+        case WorkloadKind::Layered: generate_layered(options, random, workload); break;
+        case WorkloadKind::ProteinLike: generate_protein_like(options, random, workload); break;
+    }
+
+    workload.radii.reserve(workload.points.size());
+    for (size_t i = 0; i < workload.points.size(); ++i) {
+        workload.radii.push_back(sample_radius(options, random));
+    }
+    return workload;
+}
+
+TetrahedraWorkload generate_partition_tetrahedra(PartitionType type, size_t count, uint64_t seed) {
+    static const std::array<std::array<int, 4>, 4> kColors = {{
+        {0, 0, 1, 1},  // 2-2
+        {0, 0, 0, 1},  // 3-1
+        {0, 0, 1, 2},  // 2-1-1
+        {0, 1, 2, 3}   // 1-1-1-1
+    }};
+    const auto& colors = kColors[static_cast<size_t>(type)];
+
+    // Spread like the cells of a unit-density cloud of `count` points
+    const double side = std::cbrt(static_cast<double>(std::max<size_t>(1, count)));
+    Random random(seed);
+    TetrahedraWorkload workload;
+    workload.points.reserve(4 * count);
+    workload.color_labels.reserve(4 * count);
+    workload.tetrahedra.reserve(count);
+
+    for (size_t t = 0; t < count; ++t) {
+        Point3D corner(random.uniform(0, side), random.uniform(0, side), random.uniform(0, side));
+        std::array<int, 4> order = {0, 1, 2, 3};
+        for (size_t i = 3; i > 0; --i) {
+            std::swap(order[i], order[random.index(i + 1)]);
+        }
+
+        Tetrahedron tet;
+        for (size_t i = 0; i < 4; ++i) {
+            tet[i] = static_cast<int>(workload.points.size());
+            workload.points.push_back(corner + Point3D(random.uniform(), random.uniform(), random.uniform()));
+            workload.color_labels.push_back(colors[order[i]]);
+        }
+        workload.tetrahedra.push_back(tet);
+    }
+    return workload;
+}
+
+std::string to_string(WorkloadKind kind) {
+    switch (kind) {
+        case WorkloadKind::Uniform: return "uniform";
+        case WorkloadKind::Clustered: return "clustered";
+        case WorkloadKind::Layered: return "layered";
+        case WorkloadKind::ProteinLike: return "protein";
+    }
+    return "unknown";
+}
+
+std::string to_string(RadiiDistribution radii) {
+    switch (radii) {
+        case RadiiDistribution::Constant: return "constant";
+        case RadiiDistribution::Uniform: return "uniform";
+        case RadiiDistribution::Normal: return "normal";
+        case RadiiDistribution::Atomic: return "atomic";
+    }
+    return "unknown";
+}
+
+std::string to_string(PartitionType type) {
+    switch (type) {
+        case PartitionType::TwoTwo: return "2-2";
+        case PartitionType::ThreeOne: return "3-1";
+        case PartitionType::TwoOneOne: return "2-1-1";
+        case PartitionType::OneOneOneOne: return "1-1-1-1";
+    }
+    return "unknown";
+}
+
+WorkloadKind parse_workload_kind(const std::string& name) {
+    for (auto kind : {WorkloadKind::Uniform, WorkloadKind::Clustered, WorkloadKind::Layered, WorkloadKind::ProteinLike}) {
+        if (name == to_string(kind)) return kind;
+    }
+    throw std::invalid_argument("Unknown workload '" + name + "' (uniform, clustered, layered, protein)");
+}
+
+RadiiDistribution parse_radii_distribution(const std::string& name) {
+    for (auto radii : {RadiiDistribution::Constant, RadiiDistribution::Uniform,
+                       RadiiDistribution::Normal, RadiiDistribution::Atomic}) {
+        if (name == to_string(radii)) return radii;
+    }
+    throw std::invalid_argument("Unknown radii distribution '" + name + "' (constant, uniform, normal, atomic)");
+}
+
+PartitionType parse_partition_type(const std::string& name) {
+    for (auto type : {PartitionType::TwoTwo, PartitionType::ThreeOne,
+                      PartitionType::TwoOneOne, PartitionType::OneOneOneOne}) {
+        if (name == to_string(type)) return type;
+    }
+    throw std::invalid_argument("Unknown partition type '" + name + "' (2-2, 3-1, 2-1-1, 1-1-1-1)");
+}
+
+} // namespace bench
+} // namespace delaunay_interfaces
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <delaunay_interfaces/stats.hpp>
+#include <delaunay_interfaces/types.hpp>
+#include <cstdint>
+#include <string>
+
+namespace delaunay_interfaces {
+namespace bench {
+
+enum class WorkloadKind {
+    Uniform,      // Points uniform in a cube, colors at random: interfaces everywhere
+    Clustered,    // Gaussian blobs of one color each, overlapping at their rims
+    Layered,      // Slabs of one color with wavy planar interfaces between them
+    ProteinLike   // Atoms along compact random-walk chains, one color per chain group
+};
+
+enum class RadiiDistribution {
+    Constant,  // All radii equal to `radius`
+    Uniform,   // Uniform in radius +- radius_spread
+    Normal,    // Normal with mean `radius` and deviation radius_spread, clipped at 10% of the mean
+    Atomic     // Van der Waals radii of C, N, O and S at protein frequencies
+};
+
+struct WorkloadOptions {
+    WorkloadKind kind = WorkloadKind::Uniform;
+    size_t num_points = 10000;
+    int num_colors = 2;
+    RadiiDistribution radii = RadiiDistribution::Constant;
+    double radius = 1.0;
+    double radius_spread = 0.2;
+    double density = 1.0;  // Points per unit volume; protein-like clouds use atomic spacing instead
+    uint64_t seed = 1;
+};
+
+struct Workload {
+    Points points;
+    ColorLabels color_labels;
+    Radii radii;
+};
+
+// Same options give the same workload on every platform
+Workload generate_workload(const WorkloadOptions& options);
+
+// Multicolored tetrahedra of one partition type, for feeding
+// BarycentricSubdivision without a triangulation
+struct TetrahedraWorkload {
+    Points points;
+    ColorLabels color_labels;
+    Tetrahedra tetrahedra;
+};
+
+// `count` small random tetrahedra on disjoint vertices, colored as `type`
+// (e.g. 2-1-1 as a, a, b, c) in random vertex order
+TetrahedraWorkload generate_partition_tetrahedra(PartitionType type, size_t count, uint64_t seed = 1);
+
+// Names as used on the command line and in reports ("uniform", "protein", ...)
+std::string to_string(WorkloadKind kind);
+std::string to_string(RadiiDistribution radii);
+std::string to_string(PartitionType type);  // "2-2", "3-1", "2-1-1", "1-1-1-1"
+WorkloadKind parse_workload_kind(const std::string& name);
+RadiiDistribution parse_radii_distribution(const std::string& name);
+PartitionType parse_partition_type(const std::string& name);
+
+} // namespace bench
+} // namespace delaunay_interfaces
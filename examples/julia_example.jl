@@ -13,23 +13,18 @@ function main()
     println("=" ^ 50)
     println()
 
-    # Create a simple point cloud with two color groups
+    # Create a simple point cloud with two color groups (one point per column)
     points = [
-        [0.0, 0.0, 0.0],
-        [1.0, 0.0, 0.0],
-        [0.5, 1.0, 0.0],
-        [0.5, 0.5, 1.0],
-        [2.0, 0.0, 0.0],
-        [2.5, 1.0, 0.0],
-        [2.5, 0.5, 1.0],
-        [1.5, 0.5, 0.5]
+        0.0  1.0  0.5  0.5  2.0  2.5  2.5  1.5
+        0.0  0.0  1.0  0.5  0.0  1.0  0.5  0.5
+        0.0  0.0  0.0  1.0  0.0  0.0  1.0  0.5
     ]
 
     colors = [1, 1, 1, 1, 2, 2, 2, 2]
-    radii = fill(0.3, length(points))
+    radii = fill(0.3, size(points, 2))
 
     println("Input:")
-    println("  Points: ", length(points))
+    println("  Points: ", size(points, 2))
     println("  Colors: 2 groups")
     println()
 
@@ -39,13 +34,11 @@ function main()
 
     surface = InterfaceSurface(points, colors, radii; weighted=true, alpha=true)
 
-    verts = vertices(surface)
-    filt = filtration(surface)
-
-    println("  Barycenters: ", length(verts))
-    println("  Filtration simplices: ", length(filt))
-    println("  Weighted: ", weighted(surface))
-    println("  Alpha: ", alpha(surface))
+    println("  Barycenters: ", size(surface.vertices, 2))
+    println("  Edges: ", size(surface.edges, 2))
+    println("  Interface triangles: ", size(surface.triangles, 2))
+    println("  Weighted: ", surface.weighted)
+    println("  Alpha: ", surface.alpha)
     println()
 
     # Example 2: Using convenience function
@@ -56,7 +49,7 @@ function main()
         points, colors, radii, true, true
     )
 
-    println("  Barycenters: ", length(vertices_result))
+    println("  Barycenters: ", size(vertices_result, 2))
     println("  Filtration simplices: ", length(filtration_result))
     println()
 
@@ -71,13 +64,13 @@ function main()
     println("Example 3: Get multicolored tetrahedra")
     println("-" ^ 50)
 
-    mc_tets = get_multicolored_tetrahedra_wrapper(
-        points, colors, radii; weighted=true, alpha=true
+    mc_tets = get_multicolored_tetrahedra(
+        InterfaceGenerator(), points, colors, radii; weighted=true, alpha=true
     )
 
-    println("  Number of multicolored tetrahedra: ", length(mc_tets))
-    if length(mc_tets) > 0
-        println("  First tetrahedron: ", mc_tets[1])
+    println("  Number of multicolored tetrahedra: ", size(mc_tets, 2))
+    if size(mc_tets, 2) > 0
+        println("  First tetrahedron: ", mc_tets[:, 1])
     end
     println()
 
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "types.hpp"
+#include "interface_generation.hpp"
+#include "thread_pool.hpp"
+#include <future>
+
+namespace delaunay_interfaces {
+
+// Inputs of an asynchronous computation, owned by the request so the caller's
+// buffers need not outlive it
+struct SurfaceRequest {
+    Points points;
+    ColorLabels color_labels;
+    Radii radii;
+    bool weighted = true;
+    bool alpha = true;
+};
+
+// Queue a computation on `executor` and return its result as a future. The
+// generator is copied, including its checkpoint options, progress callback and
+// executor. Pool tasks must not wait on such futures; nest with parallel_for instead.
+std::future<InterfaceSurface> compute_interface_surface_async(
+    const InterfaceGenerator& generator,
+    SurfaceRequest request,
+    Executor& executor
+);
+
+// Same, on default_thread_pool()
+std::future<InterfaceSurface> compute_interface_surface_async(
+    const InterfaceGenerator& generator,
+    SurfaceRequest request
+);
+
+} // namespace delaunay_interfaces
@@ -1,22 +1,48 @@
 #pragma once
 
 #include "types.hpp"
+#include "stats.hpp"
+#include <iosfwd>
 #include <map>
 #include <set>
 
 namespace delaunay_interfaces {
 
+class Executor;
+
 // Barycentric subdivision helper class
 class BarycentricSubdivision {
 public:
-    BarycentricSubdivision(const Points& points, const ColorLabels& color_labels);
+    BarycentricSubdivision(PointsView points, ColorLabelsView color_labels);
 
     // Process a single tetrahedron
     void process_tetrahedron(const Tetrahedron& tet);
 
     // Get results
     const Points& get_barycenters() const { return barycenters_; }
-    Filtration get_filtration() const;
+    const std::vector<GeneratingPoints>& get_generators() const { return generators_; }
+    // Sorted in parallel on `executor` if given; the order is the same either way
+    Filtration get_filtration(Executor* executor = nullptr) const;
+
+    // Work done since construction; not part of the checkpoint state
+    struct Counters {
+        std::array<size_t, 4> cells_by_partition = {};  // By PartitionType
+        size_t simplex_hits = 0;
+        size_t simplex_misses = 0;
+    };
+    const Counters& get_counters() const { return counters_; }
+
+    // Estimated heap bytes held; walks the simplex table and filtration set
+    struct MemoryUsage {
+        size_t simplex_table = 0;
+        size_t filtration = 0;
+        size_t barycenters = 0;  // Including generators
+    };
+    MemoryUsage memory_usage() const;
+
+    // Binary snapshot of the complete subdivision state, for checkpoints
+    void write_state(std::ostream& out) const;
+    void read_state(std::istream& in);
 
 private:
     // Chromatic partitioning
@@ -54,9 +80,10 @@ private:
     SimplexInfo get_or_create_simplex(const std::vector<std::vector<int>>& partitioning);
 
     // Data members
-    const Points& points_;
-    const ColorLabels& color_labels_;
+    PointsView points_;
+    ColorLabelsView color_labels_;
     Points barycenters_;
+    std::vector<GeneratingPoints> generators_;
 
     // Map from sorted vertex sets to (simplex_id, filtration_value)
     std::map<std::vector<int>, std::pair<int32_t, double>> simplex_map_;
@@ -64,6 +91,8 @@ private:
 
     // Filtration simplices
     std::set<SimplexWithFiltration> filtration_set_;
+
+    Counters counters_;
 };
 
 } // namespace delaunay_interfaces
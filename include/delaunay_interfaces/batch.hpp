@@ -0,0 +1,44 @@
+#pragma once
+
+#include "types.hpp"
+#include "thread_pool.hpp"
+
+namespace delaunay_interfaces {
+
+struct BatchOptions {
+    bool weighted = true;
+    bool alpha = true;
+    size_t num_threads = 0;  // Pool size when no pool is given; 0 = hardware concurrency
+};
+
+// One input of a batch. Radii may be empty for unweighted complexes.
+struct PointCloud {
+    PointsView points;
+    ColorLabelsView color_labels;
+    RadiiView radii;
+};
+
+// Compute the interface surfaces of many point clouds in parallel.
+// Results are returned in input order; the first failing input (by position)
+// rethrows its exception after the whole batch has finished.
+std::vector<InterfaceSurface> compute_interface_surfaces(
+    const std::vector<PointCloud>& inputs,
+    const BatchOptions& options = {}
+);
+
+std::vector<InterfaceSurface> compute_interface_surfaces(
+    const std::vector<PointCloud>& inputs,
+    Executor& executor,
+    const BatchOptions& options = {}
+);
+
+// Point clouds concatenated into single arrays: cloud i consists of the rows
+// [offsets[i], offsets[i + 1]), so there is one offset more than clouds.
+std::vector<PointCloud> split_point_clouds(
+    PointsView points,
+    ColorLabelsView color_labels,
+    RadiiView radii,
+    ArrayView<int64_t> offsets
+);
+
+} // namespace delaunay_interfaces
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace delaunay_interfaces {
+
+// Blocking FIFO with a fixed capacity, used to connect pipeline stages.
+// After close(), push() fails and pop() drains the remaining items.
+template<typename T>
+class BoundedQueue {
+public:
+    explicit BoundedQueue(size_t capacity) : capacity_(capacity ? capacity : 1) {}
+
+    // Blocks while the queue is full; returns false if the queue was closed
+    bool push(T item) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        not_full_.wait(lock, [&] { return closed_ || items_.size() < capacity_; });
+        if (closed_) return false;
+        items_.push_back(std::move(item));
+        not_empty_.notify_one();
+        return true;
+    }
+
+    // Blocks while the queue is empty; returns nullopt once closed and drained
+    std::optional<T> pop() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        not_empty_.wait(lock, [&] { return closed_ || !items_.empty(); });
+        if (items_.empty()) return std::nullopt;
+        T item = std::move(items_.front());
+        items_.pop_front();
+        not_full_.notify_one();
+        return item;
+    }
+
+    void close() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+        not_empty_.notify_all();
+        not_full_.notify_all();
+    }
+
+private:
+    size_t capacity_;
+    std::deque<T> items_;
+    bool closed_ = false;
+    std::mutex mutex_;
+    std::condition_variable not_empty_;
+    std::condition_variable not_full_;
+};
+
+// Waits on lock-free structures: yields for a while, then sleeps
+class Backoff {
+public:
+    void wait() {
+        if (++spins_ < 64) {
+            std::this_thread::yield();
+        } else {
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+    }
+
+private:
+    unsigned spins_ = 0;
+};
+
+// Lock-free FIFO ring with a fixed capacity, for exactly one producer thread
+// and one consumer thread at a time. Items should be coarse (e.g. blocks of
+// work), since waiting consumers poll.
+template<typename T>
+class SpscQueue {
+public:
+    explicit SpscQueue(size_t capacity) : slots_((capacity ? capacity : 1) + 1) {}
+
+    // Moves from `item` only on success; fails while the queue is full
+    bool try_push(T& item) {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        size_t next = (tail + 1) % slots_.size();
+        if (next == head_.load(std::memory_order_acquire)) return false;
+        slots_[tail] = std::move(item);
+        tail_.store(next, std::memory_order_release);
+        return true;
+    }
+
+    std::optional<T> try_pop() {
+        size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire)) return std::nullopt;
+        T item = std::move(slots_[head]);
+        head_.store((head + 1) % slots_.size(), std::memory_order_release);
+        return item;
+    }
+
+    // Waits for an item; returns nullopt once closed and drained
+    std::optional<T> pop() {
+        Backoff backoff;
+        while (true) {
+            if (auto item = try_pop()) return item;
+            // Items pushed before close() are visible once it is
+            if (closed_.load(std::memory_order_acquire)) return try_pop();
+            backoff.wait();
+        }
+    }
+
+    // Called by the producer after its last push
+    void close() { closed_.store(true, std::memory_order_release); }
+
+private:
+    std::vector<T> slots_;  // One slot stays free to tell full from empty
+    alignas(64) std::atomic<size_t> head_{0};
+    alignas(64) std::atomic<size_t> tail_{0};
+    std::atomic<bool> closed_{false};
+};
+
+} // namespace delaunay_interfaces
@@ -0,0 +1,116 @@
+#pragma once
+
+/*
+ * C interface to the interface surface pipeline, for Fortran, Rust and other
+ * callers without C++ interop.
+ *
+ * - Objects are opaque handles, created and destroyed through this API.
+ * - Inputs are plain arrays that are read in place and not retained.
+ * - Results stay inside a result handle. Callers query their sizes, allocate
+ *   buffers of that size and have the results copied into them.
+ * - Every fallible function returns a di_status. The message of the last error
+ *   on the calling thread is available from di_last_error_message().
+ *
+ * Existing declarations keep their signatures and meaning across versions;
+ * additions increase DI_C_API_VERSION.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DI_C_API_VERSION 1
+
+typedef enum di_status {
+    DI_OK = 0,
+    DI_INVALID_ARGUMENT = 1,   /* Inconsistent or missing inputs */
+    DI_BUFFER_TOO_SMALL = 2,   /* An output capacity is below the queried size */
+    DI_RUNTIME_ERROR = 3,      /* The computation failed */
+    DI_OUT_OF_MEMORY = 4,
+    DI_UNKNOWN_ERROR = 5
+} di_status;
+
+typedef struct di_generator di_generator;
+typedef struct di_surface di_surface;
+typedef struct di_tetrahedra di_tetrahedra;
+
+/* Points of one computation. `xyz` holds 3 * num_points coordinates, point by
+ * point; `radii` may be NULL for unweighted complexes. */
+typedef struct di_point_cloud {
+    const double* xyz;
+    const int32_t* color_labels;
+    const double* radii;
+    size_t num_points;
+} di_point_cloud;
+
+typedef struct di_surface_sizes {
+    size_t num_vertices;
+    size_t num_edges;
+    size_t num_triangles;
+} di_surface_sizes;
+
+/* Output buffers of di_surface_copy. NULL pointers are skipped. Capacities are
+ * counted in vertices, edges and triangles, not in array elements. */
+typedef struct di_surface_buffers {
+    double* vertices;          /* 3 coordinates per vertex */
+    int32_t* generators;       /* 4 input point indices per vertex, unused entries index_base - 1 */
+    double* vertex_values;     /* 1 per vertex */
+    size_t vertex_capacity;
+
+    int32_t* edges;            /* 2 vertex indices per edge, in filtration order */
+    double* edge_values;
+    size_t edge_capacity;
+
+    int32_t* triangles;        /* 3 vertex indices per triangle, in filtration order */
+    double* triangle_values;
+    size_t triangle_capacity;
+
+    int32_t index_base;        /* 0 for C and Rust, 1 for Fortran */
+} di_surface_buffers;
+
+int di_c_api_version(void);
+
+/* Message of the last failed call on this thread; empty if there was none */
+const char* di_last_error_message(void);
+
+di_status di_generator_create(di_generator** generator);
+void di_generator_destroy(di_generator* generator);
+
+/* Generators may be shared between threads */
+di_status di_compute_interface_surface(
+    const di_generator* generator,
+    const di_point_cloud* points,
+    int weighted,
+    int alpha,
+    di_surface** surface
+);
+void di_surface_destroy(di_surface* surface);
+
+di_status di_surface_get_sizes(const di_surface* surface, di_surface_sizes* sizes);
+di_status di_surface_copy(const di_surface* surface, const di_surface_buffers* buffers);
+
+di_status di_get_multicolored_tetrahedra(
+    const di_generator* generator,
+    const di_point_cloud* points,
+    int weighted,
+    int alpha,
+    di_tetrahedra** tetrahedra
+);
+void di_tetrahedra_destroy(di_tetrahedra* tetrahedra);
+
+di_status di_tetrahedra_get_count(const di_tetrahedra* tetrahedra, size_t* count);
+
+/* Copies 4 input point indices per tetrahedron; capacity is in tetrahedra */
+di_status di_tetrahedra_copy(
+    const di_tetrahedra* tetrahedra,
+    int32_t* indices,
+    size_t capacity,
+    int32_t index_base
+);
+
+#ifdef __cplusplus
+}
+#endif
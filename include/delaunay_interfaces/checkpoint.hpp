@@ -0,0 +1,62 @@
+#pragma once
+
+#include "types.hpp"
+#include <cstdint>
+#include <string>
+
+namespace delaunay_interfaces {
+
+class BarycentricSubdivision;
+
+// Checkpointing of long runs.
+//
+// A checkpoint at `path` consists of two native-endian binary files:
+//   <path>.tri  the finite cells of the triangulation, as input point indices
+//   <path>.sub  the subdivision state after a number of processed tetrahedra
+// Both are tagged with a hash of the inputs they were computed from and are
+// ignored when the inputs differ. Files are replaced atomically.
+struct CheckpointOptions {
+    std::string path;           // Empty: no checkpointing
+    size_t interval = 100000;   // Tetrahedra processed between subdivision checkpoints
+    bool resume = true;         // Continue from existing checkpoint files
+};
+
+// Finite cells of a built triangulation. The cells are all the pipeline uses
+// from CGAL, so they can be reused across processes (e.g. with other colorings).
+struct TriangulationCells {
+    uint64_t input_hash = 0;
+    Tetrahedra cells;
+};
+
+// Hash of the inputs that determine the triangulation
+uint64_t hash_triangulation_input(
+    PointsView points,
+    RadiiView radii,
+    bool weighted,
+    bool alpha
+);
+
+// Hash of the inputs that determine the subdivision
+uint64_t hash_subdivision_input(uint64_t triangulation_hash, ColorLabelsView color_labels);
+
+void save_triangulation(const std::string& path, const TriangulationCells& triangulation);
+TriangulationCells load_triangulation(const std::string& path);
+
+void save_subdivision_checkpoint(
+    const std::string& path,
+    uint64_t input_hash,
+    size_t processed,
+    const BarycentricSubdivision& subdivision
+);
+
+// Restores `subdivision` and the number of tetrahedra it had processed.
+// Returns false if there is no checkpoint at `path` or it belongs to other inputs,
+// and throws std::runtime_error if its contents are truncated or corrupt.
+bool load_subdivision_checkpoint(
+    const std::string& path,
+    uint64_t input_hash,
+    size_t& processed,
+    BarycentricSubdivision& subdivision
+);
+
+} // namespace delaunay_interfaces
@@ -9,7 +9,7 @@ namespace delaunay_interfaces {
 // Utility functions for chromatic partitioning
 inline Partition get_chromatic_partitioning(
     const Tetrahedron& tet,
-    const ColorLabels& color_labels
+    ColorLabelsView color_labels
 ) {
     std::map<int, std::vector<int>> parts_map;
 
@@ -31,7 +31,7 @@ inline Partition get_chromatic_partitioning(
     return parts;
 }
 
-inline Point3D compute_barycenter(const Points& points, const std::vector<int>& indices) {
+inline Point3D compute_barycenter(PointsView points, const std::vector<int>& indices) {
     Point3D center = Point3D::Zero();
     for (int idx : indices) {
         center += points[idx];
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "types.hpp"
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace delaunay_interfaces {
+
+// A surface in a form that does not depend on vertex ids or filtration order,
+// so results of different engines or executors can be compared. Vertices are
+// ordered by their generating points, or by coordinates for surfaces without
+// generators; simplices hold sorted 0-based positions in that order and are
+// sorted themselves.
+struct CanonicalSurface {
+    std::vector<GeneratingPoints> generators;  // Empty when ordered by coordinates
+    Points vertices;
+    std::vector<std::pair<Simplex, double>> simplices;
+};
+
+CanonicalSurface canonicalize(const InterfaceSurface& surface, bool by_generators = true);
+
+struct EquivalenceOptions {
+    // Relative to the larger magnitude, and absolute below 1
+    double value_tolerance = 1e-9;
+    double coordinate_tolerance = 1e-9;
+};
+
+struct EquivalenceResult {
+    bool equivalent = true;
+    std::string difference;  // The first difference found; empty if equivalent
+
+    explicit operator bool() const { return equivalent; }
+};
+
+// Whether `a` and `b` are the same surface up to vertex ids and simplex order.
+// Vertices are matched by generating points if both surfaces have them.
+EquivalenceResult compare_surfaces(
+    const InterfaceSurface& a,
+    const InterfaceSurface& b,
+    const EquivalenceOptions& options = {}
+);
+
+} // namespace delaunay_interfaces
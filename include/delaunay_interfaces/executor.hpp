@@ -0,0 +1,91 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+
+namespace delaunay_interfaces {
+
+// Where parallel work runs. The library's parallel stages only use this
+// interface, so they can share one pool with each other and with the
+// application (see ThreadPool and FunctionExecutor).
+class Executor {
+public:
+    virtual ~Executor() = default;
+
+    // Number of tasks that run at once
+    virtual size_t concurrency() const = 0;
+
+    // Tasks must not throw
+    virtual void submit(std::function<void()> task) = 0;
+
+    // Runs body(begin, end) over chunks of [0, count) and waits for all of them.
+    // The first exception (by chunk position) is rethrown. The calling thread
+    // runs every chunk no task has started, so this finishes even if the
+    // executor runs submitted tasks late or only on the calling thread, and
+    // may be nested inside tasks of the same executor.
+    virtual void parallel_for(
+        size_t count,
+        const std::function<void(size_t begin, size_t end)>& body,
+        size_t grain = 0  // Indices per chunk; 0 picks about 8 chunks per task slot
+    );
+
+protected:
+    size_t default_grain(size_t count) const {
+        return std::max<size_t>(1, count / (8 * std::max<size_t>(1, concurrency())));
+    }
+};
+
+// Adapter for an application-provided scheduler, e.g.
+//   FunctionExecutor executor([&](auto task) { arena.enqueue(std::move(task)); }, arena.max_concurrency());
+class FunctionExecutor : public Executor {
+public:
+    using SubmitFunction = std::function<void(std::function<void()>)>;
+
+    FunctionExecutor(SubmitFunction submit, size_t concurrency)
+        : submit_(std::move(submit)), concurrency_(concurrency ? concurrency : 1) {}
+
+    size_t concurrency() const override { return concurrency_; }
+    void submit(std::function<void()> task) override { submit_(std::move(task)); }
+
+private:
+    SubmitFunction submit_;
+    size_t concurrency_;
+};
+
+// Sorts in parallel chunks that are then merged pairwise. Runs std::sort when
+// there is no executor or the range is small. `compare` must be a total order
+// for the result not to depend on the executor.
+template<typename Iterator, typename Compare>
+void parallel_sort(Iterator first, Iterator last, Compare compare, Executor* executor) {
+    constexpr size_t kMinParallelSize = 1 << 15;
+    const size_t size = std::distance(first, last);
+    if (!executor || executor->concurrency() < 2 || size < kMinParallelSize) {
+        std::sort(first, last, compare);
+        return;
+    }
+
+    const size_t num_parts = std::min<size_t>(executor->concurrency(), size / (kMinParallelSize / 4));
+    auto bound = [&](size_t part) { return first + size * part / num_parts; };
+
+    executor->parallel_for(num_parts, [&](size_t begin, size_t end) {
+        for (size_t part = begin; part < end; ++part) {
+            std::sort(bound(part), bound(part + 1), compare);
+        }
+    }, 1);
+
+    for (size_t width = 1; width < num_parts; width *= 2) {
+        const size_t num_merges = (num_parts + 2 * width - 1) / (2 * width);
+        executor->parallel_for(num_merges, [&](size_t begin, size_t end) {
+            for (size_t merge = begin; merge < end; ++merge) {
+                size_t left = 2 * width * merge;
+                size_t middle = std::min(left + width, num_parts);
+                size_t right = std::min(left + 2 * width, num_parts);
+                std::inplace_merge(bound(left), bound(middle), bound(right), compare);
+            }
+        }, 1);
+    }
+}
+
+} // namespace delaunay_interfaces
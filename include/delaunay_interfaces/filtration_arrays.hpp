@@ -0,0 +1,21 @@
+#pragma once
+
+#include "types.hpp"
+
+namespace delaunay_interfaces {
+
+// The filtration of a surface split by dimension into flat, row-major arrays,
+// for consumers that work on whole arrays (NumPy, Julia, C). Simplices refer to
+// vertices by 0-based position in InterfaceSurface::vertices, and keep their
+// filtration order within each dimension.
+struct FiltrationArrays {
+    std::vector<double> vertex_values;    // Indexed by vertex position
+    std::vector<int32_t> edges;           // 2 vertex positions per edge
+    std::vector<double> edge_values;
+    std::vector<int32_t> triangles;       // 3 vertex positions per triangle
+    std::vector<double> triangle_values;
+};
+
+FiltrationArrays get_filtration_arrays(const InterfaceSurface& surface);
+
+} // namespace delaunay_interfaces
@@ -1,10 +1,19 @@
 #pragma once
 
 #include "types.hpp"
+#include "checkpoint.hpp"
+#include "executor.hpp"
+#include "progress.hpp"
+#include "trace.hpp"
+#include <functional>
 #include <memory>
 
 namespace delaunay_interfaces {
 
+class BarycentricSubdivision;
+
+// The computation methods are const and keep no state between calls, so one
+// generator may be used from several threads at once.
 class InterfaceGenerator {
 public:
     InterfaceGenerator() = default;
@@ -12,52 +21,151 @@ public:
 
     // Main entry point
     InterfaceSurface compute_interface_surface(
-        const Points& points,
-        const ColorLabels& color_labels,
-        const Radii& radii = {},
+        PointsView points,
+        ColorLabelsView color_labels,
+        RadiiView radii = {},
         bool weighted = true,
         bool alpha = true
-    );
+    ) const;
 
     // Get multicolored tetrahedra
     Tetrahedra get_multicolored_tetrahedra(
-        const Points& points,
-        const ColorLabels& color_labels,
-        const Radii& radii = {},
+        PointsView points,
+        ColorLabelsView color_labels,
+        RadiiView radii = {},
         bool weighted = true,
         bool alpha = true
-    );
+    ) const;
+
+    // Get all finite tetrahedra of the complex
+    Tetrahedra get_tetrahedra(
+        PointsView points,
+        RadiiView radii = {},
+        bool weighted = true,
+        bool alpha = true
+    ) const;
+
+    // Checkpoint the triangulation and subdivision progress of
+    // compute_interface_surface, and resume from existing checkpoint files.
+    // Concurrent runs must use different checkpoint paths.
+    void set_checkpoint_options(const CheckpointOptions& options);
+    CheckpointOptions get_checkpoint_options() const;
+
+    // Progress reports and cancellation; an empty callback disables them.
+    // A cancelled computation throws OperationCancelled.
+    void set_progress_callback(ProgressCallback callback);
+
+    // Runs the extraction filter and the filtration sort on `executor`; null
+    // (the default) runs everything on the calling thread. The generator and its
+    // copies share ownership of the executor. Computations running on a
+    // ThreadPool may use that same pool.
+    void set_executor(std::shared_ptr<Executor> executor);
+    std::shared_ptr<Executor> get_executor() const;
+
+    // Records the stages, executor chunks and pipeline blocks of each
+    // computation into `recorder`; null (the default) turns tracing off
+    void set_trace_recorder(std::shared_ptr<TraceRecorder> recorder);
+    std::shared_ptr<TraceRecorder> get_trace_recorder() const;
+
+    // What compute_interface_surface records in InterfaceSurface::stats;
+    // nothing by default
+    void set_stats_options(const StatsOptions& options);
+    StatsOptions get_stats_options() const;
 
 private:
+    // Receives the cells of the complex as they are extracted
+    using CellSink = std::function<void(const Tetrahedron&)>;
+
+    Tetrahedra get_tetrahedra(
+        PointsView points,
+        RadiiView radii,
+        bool weighted,
+        bool alpha,
+        const ProgressCallback* progress,
+        ComputationStats* stats,
+        bool count_predicates
+    ) const;
+
+    // Times triangulation and extraction and counts the inserted points in
+    // `stats`, if given; with `count_predicates` also the predicate stats
+    void extract_tetrahedra(
+        PointsView points,
+        RadiiView radii,
+        bool weighted,
+        bool alpha,
+        const ProgressCallback* progress,
+        ComputationStats* stats,
+        bool count_predicates,
+        const CellSink& sink
+    ) const;
+
     // Delaunay/Alpha complex computation
-    Tetrahedra get_multicolored_tetrahedra_delaunay(
-        const Points& points,
-        const ColorLabels& color_labels
-    );
-
-    Tetrahedra get_multicolored_tetrahedra_weighted_delaunay(
-        const Points& points,
-        const ColorLabels& color_labels,
-        const Radii& radii
-    );
-
-    Tetrahedra get_multicolored_tetrahedra_weighted_alpha(
-        const Points& points,
-        const ColorLabels& color_labels,
-        const Radii& radii
-    );
+    void get_tetrahedra_delaunay(
+        PointsView points,
+        const ProgressCallback* progress,
+        ComputationStats* stats,
+        bool count_predicates,
+        const CellSink& sink
+    ) const;
+
+    void get_tetrahedra_weighted_delaunay(
+        PointsView points,
+        RadiiView radii,
+        const ProgressCallback* progress,
+        ComputationStats* stats,
+        bool count_predicates,
+        const CellSink& sink
+    ) const;
+
+    void get_tetrahedra_weighted_alpha(
+        PointsView points,
+        RadiiView radii,
+        const ProgressCallback* progress,
+        ComputationStats* stats,
+        bool count_predicates,
+        const CellSink& sink
+    ) const;
 
     // Helper to check if tetrahedron is multicolored
-    bool is_multicolored(const Tetrahedron& tet, const ColorLabels& color_labels) const;
+    bool is_multicolored(const Tetrahedron& tet, ColorLabelsView color_labels) const;
+
+    Tetrahedra filter_multicolored(
+        Tetrahedra tetrahedra,
+        ColorLabelsView color_labels,
+        Executor* executor
+    ) const;
+
+    // Subdivides the multicolored cells on `executor` while they are still
+    // being extracted, in extraction order
+    void subdivide_pipelined(
+        PointsView points,
+        ColorLabelsView color_labels,
+        RadiiView radii,
+        bool weighted,
+        bool alpha,
+        const ProgressCallback* progress,
+        ComputationStats* stats,
+        bool count_predicates,
+        Executor& executor,
+        BarycentricSubdivision& subdivision
+    ) const;
+
+    // Replaced as a whole, so running computations keep the options they started with
+    std::shared_ptr<const CheckpointOptions> checkpoint_ = std::make_shared<const CheckpointOptions>();
+    std::shared_ptr<const ProgressCallback> progress_ = std::make_shared<const ProgressCallback>();
+    std::shared_ptr<Executor> executor_;
+    std::shared_ptr<TraceRecorder> trace_;
+    std::shared_ptr<const StatsOptions> stats_options_ = std::make_shared<const StatsOptions>();
 };
 
 // Barycentric subdivision functions
 std::pair<Points, Filtration> get_barycentric_subdivision_and_filtration(
-    const Points& points,
-    const ColorLabels& color_labels,
-    const Radii& radii = {},
+    PointsView points,
+    ColorLabelsView color_labels,
+    RadiiView radii = {},
     bool weighted = true,
-    bool alpha = true
+    bool alpha = true,
+    const CheckpointOptions& checkpoint = {}
 );
 
 } // namespace delaunay_interfaces
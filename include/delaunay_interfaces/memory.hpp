@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace delaunay_interfaces {
+
+struct AllocationCounters {
+    size_t count = 0;
+    size_t bytes = 0;
+};
+
+// Process-wide operator new calls since startup. Counting replaces the global
+// operator new and is only compiled in with the TRACK_ALLOCATIONS CMake
+// option; otherwise the counters stay zero.
+AllocationCounters allocation_counters();
+bool allocation_tracking_enabled();
+
+// Peak resident set size of the process so far, or 0 where unavailable
+size_t peak_resident_bytes();
+
+// Rough heap footprints for MemoryStats, assuming a malloc with two words of
+// overhead per block and red-black tree nodes with three links and a color
+constexpr size_t heap_block_bytes(size_t payload) {
+    return payload ? payload + 2 * sizeof(void*) : 0;
+}
+
+template<typename Value>
+constexpr size_t tree_node_bytes() {
+    return heap_block_bytes(4 * sizeof(void*) + sizeof(Value));
+}
+
+template<typename T>
+size_t vector_bytes(const std::vector<T>& values) {
+    return heap_block_bytes(values.capacity() * sizeof(T));
+}
+
+} // namespace delaunay_interfaces
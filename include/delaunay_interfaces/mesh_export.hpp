@@ -0,0 +1,31 @@
+#pragma once
+
+#include "types.hpp"
+#include <string>
+
+namespace delaunay_interfaces {
+
+// Mesh export of the interface triangles (2-simplices of the filtration).
+//
+// Vertices carry their barycenter position and filtration value; faces carry
+// their filtration value and the pair of colors they separate, derived from
+// the generating points of the surface and the input color labels.
+
+// Binary PLY in host byte order.
+// Vertex properties: x, y, z, filtration (double)
+// Face properties: vertex_indices (0-based), filtration (double), color_a, color_b (int)
+void write_ply(
+    const std::string& path,
+    const InterfaceSurface& surface,
+    const ColorLabels& color_labels
+);
+
+// Wavefront OBJ. The vertex filtration value is stored as texture coordinate
+// `vt value 0`, and faces are grouped by color pair (`g interface_<a>_<b>`).
+void write_obj(
+    const std::string& path,
+    const InterfaceSurface& surface,
+    const ColorLabels& color_labels
+);
+
+} // namespace delaunay_interfaces
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "types.hpp"
+#include "executor.hpp"
+#include <array>
+#include <cstdint>
+#include <memory>
+
+namespace delaunay_interfaces {
+
+struct PreflightOptions {
+    size_t sample_size = 40000;  // Points computed in all; smaller inputs are computed whole
+    size_t windows = 4;          // Neighbourhoods of random input points the sample is made of
+    uint64_t seed = 1;
+    // The executor the real computation will run on, since it changes the
+    // time and, when pipelined, the memory; null = the calling thread
+    std::shared_ptr<Executor> executor;
+};
+
+// What compute_interface_surface is expected to produce and need for the
+// whole input, extrapolated from the sample. Neighbourhoods keep the density
+// and colors of the input around them, so inputs whose structure varies over
+// larger distances than a window need more windows to be represented.
+struct PreflightEstimate {
+    size_t points = 0;
+    size_t sampled_points = 0;
+    double sample_seconds = 0;  // Time taken by the estimate itself
+    bool exact = false;         // The input was small enough to compute whole
+
+    size_t finite_cells = 0;
+    size_t multicolored_cells = 0;
+    std::array<size_t, 4> cells_by_partition = {};      // By PartitionType
+    std::array<size_t, 3> simplices_by_dimension = {};  // Output vertices, edges, triangles
+    MemoryStats memory;         // Without peak_rss_bytes
+
+    // Wall time, scaled from the sample by points^time_exponent; the exponent
+    // is fitted to the sample at full and quarter window size
+    double seconds = 0;
+    double time_exponent = 1;
+};
+
+PreflightEstimate estimate_interface_surface(
+    PointsView points,
+    ColorLabelsView color_labels,
+    RadiiView radii = {},
+    bool weighted = true,
+    bool alpha = true,
+    const PreflightOptions& options = {}
+);
+
+} // namespace delaunay_interfaces
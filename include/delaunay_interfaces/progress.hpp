@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+
+namespace delaunay_interfaces {
+
+enum class ComputationStage {
+    Triangulation,  // Inserting points into the triangulation
+    Extraction,     // Collecting the cells of the complex
+    Subdivision,    // Subdividing the multicolored tetrahedra
+    Sorting         // Ordering the filtration
+};
+
+struct Progress {
+    ComputationStage stage;
+    size_t done;
+    size_t total;  // 0 while unknown, e.g. for subdivision overlapping extraction
+};
+
+// Called at stage boundaries and periodically within stages, possibly from
+// several threads at once: pipelined stages report concurrently, and a
+// generator may be shared. Returning false cancels the run.
+using ProgressCallback = std::function<bool(const Progress&)>;
+
+// Thrown out of a computation whose progress callback asked to cancel
+class OperationCancelled : public std::runtime_error {
+public:
+    OperationCancelled() : std::runtime_error("Computation cancelled") {}
+};
+
+// Reports the progress of one stage. advance() only compares a counter, so it
+// can sit in hot loops; the callback runs every `interval` items.
+class ProgressReporter {
+public:
+    ProgressReporter(const ProgressCallback* callback, ComputationStage stage, size_t total, size_t interval = 4096)
+        : callback_(callback && *callback ? callback : nullptr),
+          stage_(stage),
+          total_(total),
+          interval_(interval ? interval : 1),
+          next_report_(callback_ ? 0 : std::numeric_limits<size_t>::max()) {
+        advance(0);
+    }
+
+    void advance(size_t count = 1) {
+        done_ += count;
+        if (done_ >= next_report_) {
+            report();
+        }
+    }
+
+    void set_total(size_t total) { total_ = total; }
+
+    // Reports the stage as complete
+    void finish() {
+        done_ = total_;
+        if (callback_) report();
+    }
+
+private:
+    void report() {
+        next_report_ = done_ + interval_;
+        if (!(*callback_)(Progress{stage_, done_, total_})) {
+            throw OperationCancelled();
+        }
+    }
+
+    const ProgressCallback* callback_;
+    ComputationStage stage_;
+    size_t total_;
+    size_t interval_;
+    size_t done_ = 0;
+    size_t next_report_;
+};
+
+} // namespace delaunay_interfaces
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "types.hpp"
+#include <string>
+#include <string_view>
+
+namespace delaunay_interfaces {
+
+enum class SurfaceEncoding {
+    Raw,        // Fixed-width arrays, fastest to read and write
+    Compressed  // Delta + varint coded ids, optionally quantized values
+};
+
+struct SerializationOptions {
+    SurfaceEncoding encoding = SurfaceEncoding::Compressed;
+    // Compressed encoding only. With a quantum > 0, values are rounded to
+    // multiples of it (lossy); with 0 they are stored exactly.
+    double value_quantum = 0.0;       // Filtration values
+    double coordinate_quantum = 0.0;  // Vertex coordinates
+};
+
+// Self-contained binary format of an InterfaceSurface, in host byte order.
+// The filtration order is preserved exactly.
+std::string serialize_interface_surface(
+    const InterfaceSurface& surface,
+    const SerializationOptions& options = {}
+);
+
+InterfaceSurface deserialize_interface_surface(std::string_view data);
+
+void save_interface_surface(
+    const std::string& path,
+    const InterfaceSurface& surface,
+    const SerializationOptions& options = {}
+);
+
+InterfaceSurface load_interface_surface(const std::string& path);
+
+} // namespace delaunay_interfaces
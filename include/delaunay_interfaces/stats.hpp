@@ -0,0 +1,173 @@
+#pragma once
+
+#include "memory.hpp"
+#include "progress.hpp"
+#include "trace.hpp"
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <ctime>
+
+namespace delaunay_interfaces {
+
+// Multicolored tetrahedra by the sizes of their color classes
+enum class PartitionType { TwoTwo, ThreeOne, TwoOneOne, OneOneOneOne };
+
+struct StageTiming {
+    double wall_seconds = 0;
+    // Process CPU time, so parallel stages include their helper threads. Stages
+    // that overlap (pipelined extraction and subdivision) or computations running
+    // concurrently are counted in each other's CPU time.
+    double cpu_seconds = 0;
+    // Process-wide operator new calls during the stage; zero unless built with
+    // TRACK_ALLOCATIONS (see allocation_tracking_enabled())
+    size_t allocations = 0;
+    size_t allocated_bytes = 0;
+};
+
+// Estimated heap bytes of the internal structures, each at its largest
+struct MemoryStats {
+    size_t triangulation_bytes = 0;  // CGAL triangulation and vertex index
+    size_t cells_bytes = 0;          // Extracted cells, or the pipeline's queued blocks
+    size_t simplex_table_bytes = 0;  // Map from vertex sets to subdivision simplices
+    size_t filtration_bytes = 0;     // Filtration set plus the sorted output
+    size_t barycenter_bytes = 0;     // Barycenters and their generators
+    // Largest sum of the structures alive at once; an upper estimate where
+    // extraction and subdivision overlap
+    size_t peak_bytes = 0;
+    size_t peak_rss_bytes = 0;       // Peak resident set of the whole process; 0 if unknown
+};
+
+// Geometric predicates deciding the triangulation
+enum class PredicateType {
+    Orientation,  // Which side of a plane a point lies on
+    InSphere      // Inside a cell's circumsphere; the power test for weighted points
+};
+
+// Predicates re-evaluated on the final triangulation, not counted during
+// insertion: the orientation of every finite cell and the in-sphere test
+// across every facet between finite cells. Insertion evaluates the same
+// predicates on similar configurations many more times, so these sample how
+// often it falls back to exact arithmetic.
+struct PredicateStats {
+    size_t evaluations = 0;
+    size_t filter_failures = 0;  // Undecided by interval arithmetic, so evaluated exactly
+    // Exactly zero: five points on one sphere. Cells of a triangulation are
+    // never flat, so always zero for orientations.
+    size_t degenerate = 0;
+};
+
+// What compute_interface_surface records in InterfaceSurface::stats. Off by
+// default, so computations nobody inspects do no bookkeeping.
+struct StatsOptions {
+    bool enabled = false;  // Stage times and work counters; off leaves stats empty
+    // Also fill ComputationStats::memory, which walks every simplex once more
+    // and reads the resident set from the OS; off leaves it zero
+    bool memory = false;
+    // Also fill ComputationStats::predicates, which evaluates the predicates
+    // of the final triangulation again after it is built; off leaves it zero
+    bool predicates = false;
+};
+
+// Where the time of one computation went and how much work each stage did.
+// After resuming from a checkpoint, only the work of the resumed run is counted.
+struct ComputationStats {
+    std::array<StageTiming, 4> stages;  // By ComputationStage
+
+    size_t points_inserted = 0;
+    size_t hidden_points = 0;       // Without a vertex: duplicates, or weighted points hidden by others
+    size_t finite_cells = 0;        // Tetrahedra of the complex
+    size_t multicolored_cells = 0;
+    std::array<size_t, 4> cells_by_partition = {};  // By PartitionType
+    size_t simplex_hits = 0;        // Subdivision simplices found in the simplex table
+    size_t simplex_misses = 0;      // Subdivision simplices created
+    std::array<size_t, 3> simplices_by_dimension = {};  // Output vertices, edges, triangles
+
+    std::array<PredicateStats, 2> predicates = {};  // By PredicateType
+    MemoryStats memory;
+
+    StageTiming& stage(ComputationStage stage) { return stages[static_cast<size_t>(stage)]; }
+    const StageTiming& stage(ComputationStage stage) const { return stages[static_cast<size_t>(stage)]; }
+};
+
+// Stage names as shown in traces
+inline const char* stage_name(ComputationStage stage) {
+    switch (stage) {
+        case ComputationStage::Triangulation: return "triangulation";
+        case ComputationStage::Extraction: return "extraction";
+        case ComputationStage::Subdivision: return "subdivision";
+        case ComputationStage::Sorting: return "sorting";
+    }
+    return "unknown";
+}
+
+// Told when a stage starts and stops, on the thread running it. Stages can
+// overlap (pipelined extraction and subdivision), and so can computations on
+// different threads. The benchmark reads hardware counters through this.
+class StageObserver {
+public:
+    virtual ~StageObserver() = default;
+    virtual void stage_started(ComputationStage stage) = 0;
+    virtual void stage_stopped(ComputationStage stage) = 0;
+};
+
+// Process-wide; null (the default) turns notifications off. The observer must
+// outlive the computations running while it is set.
+void set_stage_observer(StageObserver* observer);
+StageObserver* get_stage_observer();
+
+// Adds the time and allocations from construction to stop() (or destruction)
+// to a stage of `stats`, if not null, traces the stage while tracing is on and
+// notifies the stage observer, if any
+class StageClock {
+public:
+    StageClock(ComputationStats* stats, ComputationStage stage)
+        : timing_(stats ? &stats->stage(stage) : nullptr),
+          trace_(current_trace_recorder()),
+          observer_(get_stage_observer()),
+          stage_(stage) {
+        // Without stats or a trace, only the observer is told
+        if (timing_ || trace_) wall_ = std::chrono::steady_clock::now();
+        if (timing_) {
+            cpu_ = std::clock();
+            allocations_ = allocation_counters();
+        }
+        if (observer_) observer_->stage_started(stage_);
+    }
+
+    ~StageClock() { stop(); }
+
+    StageClock(const StageClock&) = delete;
+    StageClock& operator=(const StageClock&) = delete;
+
+    void stop() {
+        if (observer_) {
+            observer_->stage_stopped(stage_);
+            observer_ = nullptr;
+        }
+        if (!timing_ && !trace_) return;
+        auto now = std::chrono::steady_clock::now();
+        if (trace_) {
+            trace_->record(stage_name(stage_), "stage", wall_, now);
+            trace_ = nullptr;
+        }
+        if (!timing_) return;
+        timing_->wall_seconds += std::chrono::duration<double>(now - wall_).count();
+        timing_->cpu_seconds += static_cast<double>(std::clock() - cpu_) / CLOCKS_PER_SEC;
+        AllocationCounters allocations = allocation_counters();
+        timing_->allocations += allocations.count - allocations_.count;
+        timing_->allocated_bytes += allocations.bytes - allocations_.bytes;
+        timing_ = nullptr;
+    }
+
+private:
+    StageTiming* timing_;
+    TraceRecorder* trace_;
+    StageObserver* observer_;
+    ComputationStage stage_;
+    std::chrono::steady_clock::time_point wall_;
+    std::clock_t cpu_ = 0;
+    AllocationCounters allocations_;
+};
+
+} // namespace delaunay_interfaces
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "types.hpp"
+#include <fstream>
+#include <string>
+#include <string_view>
+
+namespace delaunay_interfaces {
+
+enum class StructureFormat {
+    Auto,   // From the file extension
+    PDB,
+    MMCIF,
+    XYZ,    // Element x y z [group]
+    CSV     // x,y,z[,label[,radius]] or a header naming the columns
+};
+
+// How atoms are grouped into colors
+enum class ColoringScheme {
+    Chain,
+    Residue,
+    Entity
+};
+
+struct StructureReadOptions {
+    StructureFormat format = StructureFormat::Auto;
+    ColoringScheme coloring = ColoringScheme::Chain;
+    bool include_hetatm = true;
+    bool include_water = false;
+    bool include_hydrogens = true;
+    double default_radius = 1.7;   // For elements missing from the radius table
+    double radius_offset = 0.0;    // Added to every radius (e.g. a probe radius)
+    unsigned num_threads = 0;      // 0 = hardware concurrency
+};
+
+// Arrays in the form InterfaceGenerator consumes
+struct StructureData {
+    Points points;
+    ColorLabels color_labels;           // 0-based, in order of first appearance
+    Radii radii;
+    std::vector<std::string> color_names; // Chain/residue/entity name of each label
+};
+
+// Bondi van der Waals radius of an element symbol (case-insensitive),
+// or `fallback` if the element is not tabulated
+double get_vdw_radius(std::string_view element, double fallback = 1.7);
+
+StructureFormat get_structure_format(const std::string& path);
+
+StructureData read_structure(const std::string& path, const StructureReadOptions& options = {});
+
+// Parse in-memory file contents; `options.format` must not be Auto
+StructureData parse_structure(std::string_view text, const StructureReadOptions& options);
+
+// Reads multi-frame files one frame at a time: the models of a PDB file
+// (MODEL/ENDMDL) or the concatenated frames of an XYZ file. mmCIF and CSV
+// files are read as a single frame.
+class StructureFrameReader {
+public:
+    explicit StructureFrameReader(const std::string& path, const StructureReadOptions& options = {});
+
+    // Parse the next frame into `frame`; returns false at the end of the file
+    bool read_next(StructureData& frame);
+
+private:
+    bool read_next_pdb(std::string& text);
+    bool read_next_xyz(std::string& text);
+
+    std::ifstream in_;
+    StructureReadOptions options_;
+    std::string header_;    // PDB records preceding the first model
+    bool header_read_ = false;
+    bool finished_ = false;
+};
+
+} // namespace delaunay_interfaces
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "executor.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace delaunay_interfaces {
+
+struct ThreadPoolOptions {
+    size_t num_threads = 0;        // 0 = hardware concurrency
+    std::vector<int> cpu_affinity; // Worker i is pinned to cpu_affinity[i % size]; empty = unpinned
+};
+
+// Work-stealing thread pool. Every worker owns a task deque: it takes its own
+// tasks newest first and, when it runs out, steals the oldest tasks of the
+// other workers. Tasks submitted from a worker go to that worker's deque.
+class ThreadPool : public Executor {
+public:
+    explicit ThreadPool(size_t num_threads = 0); // 0 = hardware concurrency
+    // CPU pinning is applied on Linux and ignored elsewhere
+    explicit ThreadPool(const ThreadPoolOptions& options);
+    ~ThreadPool() override;                      // Runs the queued tasks, then joins
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    size_t size() const { return threads_.size(); }
+    size_t concurrency() const override { return size(); }
+
+    // Tasks must not throw
+    void submit(std::function<void()> task) override;
+
+    // Runs body(begin, end) over chunks of [0, count) and waits for all of them.
+    // The calling thread runs tasks while it waits, so this may be nested in
+    // pool tasks. The first exception (by chunk position) is rethrown.
+    void parallel_for(
+        size_t count,
+        const std::function<void(size_t begin, size_t end)>& body,
+        size_t grain = 0  // Indices per chunk; 0 picks about 8 chunks per thread
+    ) override;
+
+private:
+    struct TaskQueue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    void worker_loop(size_t index, int cpu);
+    bool run_one(size_t preferred);
+    void notify_all();
+
+    std::vector<std::unique_ptr<TaskQueue>> queues_;
+    std::vector<std::thread> threads_;
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::atomic<size_t> queued_{0};
+    std::atomic<size_t> next_queue_{0};
+    bool stopping_ = false;
+};
+
+// Process-wide pool with one thread per core, created on first use
+ThreadPool& default_thread_pool();
+
+} // namespace delaunay_interfaces
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace delaunay_interfaces {
+
+// Collects timed spans from any number of threads and writes them in the
+// Chrome trace event format (chrome://tracing, https://ui.perfetto.dev)
+class TraceRecorder {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    // Names and categories are not copied, so they must be string literals
+    struct Event {
+        const char* name;
+        const char* category;
+        int64_t begin_ns;     // Since the recorder was created or cleared
+        int64_t duration_ns;
+        uint32_t thread;      // trace_thread_id() of the recording thread
+        int64_t index;        // Chunk or block number; -1 if none
+    };
+
+    TraceRecorder();
+
+    void record(const char* name, const char* category, Clock::time_point begin, Clock::time_point end,
+                int64_t index = -1);
+
+    std::vector<Event> get_events() const;
+    void clear();
+
+    void write_chrome_trace(std::ostream& out) const;
+    void write_chrome_trace(const std::string& path) const;
+
+private:
+    mutable std::mutex mutex_;
+    Clock::time_point origin_;
+    std::vector<Event> events_;
+    std::map<uint32_t, std::string> thread_names_;
+};
+
+// Small id of the calling thread, stable for its lifetime
+uint32_t trace_thread_id();
+// Names the calling thread in traces (e.g. "worker 2"); unnamed threads show as "thread <id>"
+void set_trace_thread_name(std::string name);
+
+// The recorder spans on the calling thread go to; null while tracing is off
+TraceRecorder* current_trace_recorder();
+
+// Makes `recorder` (possibly null) current on this thread for its lifetime
+class TraceScope {
+public:
+    explicit TraceScope(TraceRecorder* recorder);
+    ~TraceScope();
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    TraceRecorder* previous_;
+};
+
+// Records its lifetime with the current recorder. Costs one thread-local load
+// while tracing is off.
+class TraceSpan {
+public:
+    explicit TraceSpan(const char* name, const char* category = "stage", int64_t index = -1)
+        : recorder_(current_trace_recorder()), name_(name), category_(category), index_(index) {
+        if (recorder_) begin_ = TraceRecorder::Clock::now();
+    }
+
+    ~TraceSpan() {
+        if (recorder_) recorder_->record(name_, category_, begin_, TraceRecorder::Clock::now(), index_);
+    }
+
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+
+private:
+    TraceRecorder* recorder_;
+    const char* name_;
+    const char* category_;
+    int64_t index_;
+    TraceRecorder::Clock::time_point begin_;
+};
+
+} // namespace delaunay_interfaces
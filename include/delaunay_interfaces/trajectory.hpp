@@ -0,0 +1,37 @@
+#pragma once
+
+#include "types.hpp"
+#include "structure_io.hpp"
+#include <functional>
+#include <string>
+
+namespace delaunay_interfaces {
+
+struct TrajectoryOptions {
+    StructureReadOptions read_options;
+    bool weighted = true;
+    bool alpha = true;
+    size_t max_in_flight = 4;      // Frames read but not yet written
+    unsigned compute_threads = 1;  // Frames computed concurrently
+};
+
+struct TrajectoryFrame {
+    size_t index;
+    StructureData structure;
+    InterfaceSurface surface;
+};
+
+using FrameWriter = std::function<void(const TrajectoryFrame&)>;
+
+// Process the frames of a multi-frame structure file as a pipeline: a reader
+// thread parses frame k+1 while frame k is computed and frame k-1 is written.
+// The stages are connected by bounded queues, and at most `max_in_flight`
+// frames are held at once. `write_frame` runs on the calling thread, in frame
+// order. Returns the number of frames processed.
+size_t process_trajectory(
+    const std::string& path,
+    const FrameWriter& write_frame,
+    const TrajectoryOptions& options = {}
+);
+
+} // namespace delaunay_interfaces
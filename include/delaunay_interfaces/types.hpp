@@ -1,5 +1,8 @@
 #pragma once
 
+#include "stats.hpp"
+#include <array>
+#include <optional>
 #include <vector>
 #include <tuple>
 #include <cstdint>
@@ -18,6 +21,51 @@ using Simplex = std::vector<int32_t>;
 using SimplexWithFiltration = std::tuple<Simplex, double>;
 using Filtration = std::vector<SimplexWithFiltration>;
 using Partition = std::vector<std::vector<int>>;
+using GeneratingPoints = std::array<int, 4>; // Input point indices, padded with -1
+
+// Non-owning views of input arrays. The computation reads its inputs through
+// these, so callers holding plain buffers (e.g. NumPy arrays) need not copy
+// them into vectors. The viewed memory must outlive the call.
+template<typename T>
+class ArrayView {
+public:
+    ArrayView() = default;
+    ArrayView(const T* data, size_t size) : data_(data), size_(size) {}
+    ArrayView(const std::vector<T>& values) : data_(values.data()), size_(values.size()) {}
+
+    const T* data() const { return data_; }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    const T& operator[](size_t i) const { return data_[i]; }
+    const T* begin() const { return data_; }
+    const T* end() const { return data_ + size_; }
+
+private:
+    const T* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+using ColorLabelsView = ArrayView<int>;
+using RadiiView = ArrayView<double>;
+
+static_assert(sizeof(Point3D) == 3 * sizeof(double), "Points must be packed xyz triples");
+
+// Row-major (N, 3) coordinates
+class PointsView {
+public:
+    PointsView() = default;
+    PointsView(const double* xyz, size_t size) : xyz_(xyz), size_(size) {}
+    PointsView(const Points& points) : xyz_(points.empty() ? nullptr : points.data()->data()), size_(points.size()) {}
+
+    const double* data() const { return xyz_; }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    Eigen::Map<const Point3D> operator[](size_t i) const { return Eigen::Map<const Point3D>(xyz_ + 3 * i); }
+
+private:
+    const double* xyz_ = nullptr;
+    size_t size_ = 0;
+};
 
 // Configuration struct
 struct ComplexConfig {
@@ -34,6 +82,8 @@ struct InterfaceSurface {
     Filtration filtration;
     bool weighted;
     bool alpha;
+    std::vector<GeneratingPoints> generators; // Per vertex, sorted
+    std::optional<ComputationStats> stats;    // Set by compute_interface_surface if enabled; not stored in files
 };
 
 } // namespace delaunay_interfaces
@@ -1,57 +1,226 @@
 #include "jlcxx/jlcxx.hpp"
+#include "jlcxx/array.hpp"
 #include "delaunay_interfaces/interface_generation.hpp"
-#include <vector>
+#include "delaunay_interfaces/filtration_arrays.hpp"
+#include <array>
+#include <cstdint>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 using namespace delaunay_interfaces;
 
+// Results whose arrays are handed to Julia without copying. The Julia side
+// keeps these objects alive for as long as any array over their memory.
+// Indices are converted to Julia's 1-based convention in place.
+struct SurfaceBuffers {
+    InterfaceSurface surface;
+    FiltrationArrays arrays;
+};
+
+struct TetrahedraBuffer {
+    Tetrahedra tetrahedra;
+};
+
 // Mark types as non-mirrored
 namespace jlcxx {
     template<> struct IsMirroredType<InterfaceGenerator> : std::false_type { };
+    template<> struct IsMirroredType<SurfaceBuffers> : std::false_type { };
+    template<> struct IsMirroredType<TetrahedraBuffer> : std::false_type { };
+    template<> struct IsMirroredType<StageTiming> : std::false_type { };
+    template<> struct IsMirroredType<PredicateStats> : std::false_type { };
+    template<> struct IsMirroredType<MemoryStats> : std::false_type { };
+    template<> struct IsMirroredType<ComputationStats> : std::false_type { };
+}
+
+namespace {
+
+// Points arrive as a column-major 3×N matrix, i.e. packed xyz triples
+PointsView points_view(jlcxx::ArrayRef<double, 2> points) {
+    if (points.size() % 3 != 0) {
+        throw std::invalid_argument("points must be a 3×N matrix");
+    }
+    return PointsView(points.data(), points.size() / 3);
 }
 
-// Helper to convert Julia arrays to C++ vectors
 template<typename T>
-std::vector<T> julia_array_to_vector(jlcxx::ArrayRef<T> arr) {
-    return std::vector<T>(arr.begin(), arr.end());
+void to_one_based(T* values, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        values[i] += 1;
+    }
+}
+
+// Julia array over a C++ buffer of `rows` entries per column
+template<typename T>
+jlcxx::ArrayRef<T, 2> matrix_ref(T* data, size_t rows, size_t size) {
+    return jlcxx::ArrayRef<T, 2>(data, rows, size / rows);
+}
+
+template<typename T>
+jlcxx::ArrayRef<T, 1> vector_ref(std::vector<T>& values) {
+    return jlcxx::ArrayRef<T, 1>(values.data(), values.size());
+}
+
+// Julia array over a fixed-size array of counts
+template<size_t N>
+jlcxx::ArrayRef<size_t, 1> counts_ref(std::array<size_t, N>& counts) {
+    return jlcxx::ArrayRef<size_t, 1>(counts.data(), N);
+}
+
+// Element `index` (1-based) of a per-stage or per-type array
+template<typename T, size_t N>
+T& at_one_based(std::array<T, N>& values, int64_t index) {
+    if (index < 1 || index > static_cast<int64_t>(N)) {
+        throw std::out_of_range("index " + std::to_string(index) + " out of 1:" + std::to_string(N));
+    }
+    return values[index - 1];
 }
 
+int64_t count(size_t value) {
+    return static_cast<int64_t>(value);
+}
+
+} // namespace
+
 JLCXX_MODULE define_julia_module(jlcxx::Module& mod) {
     mod.method("version", []() { return std::string("0.1.0"); });
 
+    // ComputationStats and its parts, read field by field into the Julia
+    // ComputationStats; the Cxx prefix keeps that name free
+    mod.add_type<StageTiming>("CxxStageTiming")
+        .method("wall_seconds", [](const StageTiming& timing) { return timing.wall_seconds; })
+        .method("cpu_seconds", [](const StageTiming& timing) { return timing.cpu_seconds; })
+        .method("allocations", [](const StageTiming& timing) { return count(timing.allocations); })
+        .method("allocated_bytes", [](const StageTiming& timing) { return count(timing.allocated_bytes); });
+
+    mod.add_type<PredicateStats>("CxxPredicateStats")
+        .method("evaluations", [](const PredicateStats& predicate) { return count(predicate.evaluations); })
+        .method("filter_failures", [](const PredicateStats& predicate) { return count(predicate.filter_failures); })
+        .method("degenerate", [](const PredicateStats& predicate) { return count(predicate.degenerate); });
+
+    mod.add_type<MemoryStats>("CxxMemoryStats")
+        .method("triangulation_bytes", [](const MemoryStats& memory) { return count(memory.triangulation_bytes); })
+        .method("cells_bytes", [](const MemoryStats& memory) { return count(memory.cells_bytes); })
+        .method("simplex_table_bytes", [](const MemoryStats& memory) { return count(memory.simplex_table_bytes); })
+        .method("filtration_bytes", [](const MemoryStats& memory) { return count(memory.filtration_bytes); })
+        .method("barycenter_bytes", [](const MemoryStats& memory) { return count(memory.barycenter_bytes); })
+        .method("peak_bytes", [](const MemoryStats& memory) { return count(memory.peak_bytes); })
+        .method("peak_rss_bytes", [](const MemoryStats& memory) { return count(memory.peak_rss_bytes); });
+
+    mod.add_type<ComputationStats>("CxxComputationStats")
+        .method("stage_count", [](const ComputationStats& stats) { return count(stats.stages.size()); })
+        .method("stage", [](ComputationStats& stats, int64_t index) -> StageTiming& {
+            return at_one_based(stats.stages, index);
+        })
+        .method("points_inserted", [](const ComputationStats& stats) { return count(stats.points_inserted); })
+        .method("hidden_points", [](const ComputationStats& stats) { return count(stats.hidden_points); })
+        .method("finite_cells", [](const ComputationStats& stats) { return count(stats.finite_cells); })
+        .method("multicolored_cells", [](const ComputationStats& stats) { return count(stats.multicolored_cells); })
+        .method("cells_by_partition", [](ComputationStats& stats) { return counts_ref(stats.cells_by_partition); })
+        .method("simplex_hits", [](const ComputationStats& stats) { return count(stats.simplex_hits); })
+        .method("simplex_misses", [](const ComputationStats& stats) { return count(stats.simplex_misses); })
+        .method("simplices_by_dimension", [](ComputationStats& stats) {
+            return counts_ref(stats.simplices_by_dimension);
+        })
+        // 1 = orientation, 2 = in-sphere, as PredicateType
+        .method("predicate", [](ComputationStats& stats, int64_t index) -> PredicateStats& {
+            return at_one_based(stats.predicates, index);
+        })
+        .method("memory", [](ComputationStats& stats) -> MemoryStats& { return stats.memory; });
+
+    mod.add_type<SurfaceBuffers>("SurfaceBuffers")
+        .method("vertices_buffer", [](SurfaceBuffers& buffers) {
+            auto& vertices = buffers.surface.vertices;
+            return matrix_ref(vertices.empty() ? nullptr : vertices.data()->data(), 3, 3 * vertices.size());
+        })
+        .method("generators_buffer", [](SurfaceBuffers& buffers) {
+            auto& generators = buffers.surface.generators;
+            return matrix_ref(generators.empty() ? nullptr : generators.data()->data(), 4, 4 * generators.size());
+        })
+        .method("vertex_values_buffer", [](SurfaceBuffers& buffers) {
+            return vector_ref(buffers.arrays.vertex_values);
+        })
+        .method("edges_buffer", [](SurfaceBuffers& buffers) {
+            return matrix_ref(buffers.arrays.edges.data(), 2, buffers.arrays.edges.size());
+        })
+        .method("edge_values_buffer", [](SurfaceBuffers& buffers) {
+            return vector_ref(buffers.arrays.edge_values);
+        })
+        .method("triangles_buffer", [](SurfaceBuffers& buffers) {
+            return matrix_ref(buffers.arrays.triangles.data(), 3, buffers.arrays.triangles.size());
+        })
+        .method("triangle_values_buffer", [](SurfaceBuffers& buffers) {
+            return vector_ref(buffers.arrays.triangle_values);
+        })
+        .method("has_stats", [](const SurfaceBuffers& buffers) { return buffers.surface.stats.has_value(); })
+        .method("computation_stats", [](SurfaceBuffers& buffers) -> ComputationStats& {
+            if (!buffers.surface.stats) throw std::runtime_error("The surface has no stats");
+            return *buffers.surface.stats;
+        })
+        .method("is_weighted", [](const SurfaceBuffers& buffers) { return buffers.surface.weighted; })
+        .method("is_alpha", [](const SurfaceBuffers& buffers) { return buffers.surface.alpha; });
+
+    mod.add_type<TetrahedraBuffer>("TetrahedraBuffer")
+        .method("tetrahedra_buffer", [](TetrahedraBuffer& buffer) {
+            auto& tetrahedra = buffer.tetrahedra;
+            return matrix_ref(tetrahedra.empty() ? nullptr : tetrahedra.data()->data(), 4, 4 * tetrahedra.size());
+        });
+
     // InterfaceGenerator
     mod.add_type<InterfaceGenerator>("InterfaceGenerator")
         .constructor<>()
-        .method("get_multicolored_tetrahedra", [](
-            InterfaceGenerator& gen,
-            jlcxx::ArrayRef<jlcxx::ArrayRef<double>> points_arr,
-            jlcxx::ArrayRef<int> color_labels_arr,
-            jlcxx::ArrayRef<double> radii_arr,
+        .method("set_stats_options", [](InterfaceGenerator& gen, bool enabled, bool memory, bool predicates) {
+            StatsOptions options;
+            options.enabled = enabled;
+            options.memory = memory;
+            options.predicates = predicates;
+            gen.set_stats_options(options);
+        })
+        .method("compute_surface_buffers", [](
+            const InterfaceGenerator& gen,
+            jlcxx::ArrayRef<double, 2> points,
+            jlcxx::ArrayRef<int> color_labels,
+            jlcxx::ArrayRef<double> radii,
             bool weighted,
             bool alpha
         ) {
-            Points points;
-            for (const auto& p : points_arr) {
-                if (p.size() != 3) {
-                    throw std::runtime_error("Each point must be 3D");
-                }
-                points.emplace_back(p[0], p[1], p[2]);
-            }
-
-            ColorLabels color_labels = julia_array_to_vector(color_labels_arr);
-            Radii radii = julia_array_to_vector(radii_arr);
-
-            auto tets = gen.get_multicolored_tetrahedra(points, color_labels, radii, weighted, alpha);
+            SurfaceBuffers buffers;
+            buffers.surface = gen.compute_interface_surface(
+                points_view(points),
+                ColorLabelsView(color_labels.data(), color_labels.size()),
+                RadiiView(radii.data(), radii.size()),
+                weighted, alpha
+            );
+            buffers.arrays = get_filtration_arrays(buffers.surface);
 
-            // Convert to a flat array where each 4 consecutive integers represent one tetrahedron
-            std::vector<int> result;
-            result.reserve(tets.size() * 4);
-            for (const auto& tet : tets) {
-                result.push_back(tet[0]);
-                result.push_back(tet[1]);
-                result.push_back(tet[2]);
-                result.push_back(tet[3]);
+            auto& arrays = buffers.arrays;
+            to_one_based(arrays.edges.data(), arrays.edges.size());
+            to_one_based(arrays.triangles.data(), arrays.triangles.size());
+            // Padding -1 becomes 0
+            auto& generators = buffers.surface.generators;
+            if (!generators.empty()) {
+                to_one_based(generators.data()->data(), 4 * generators.size());
+            }
+            return buffers;
+        })
+        .method("multicolored_tetrahedra_buffer", [](
+            const InterfaceGenerator& gen,
+            jlcxx::ArrayRef<double, 2> points,
+            jlcxx::ArrayRef<int> color_labels,
+            jlcxx::ArrayRef<double> radii,
+            bool weighted,
+            bool alpha
+        ) {
+            TetrahedraBuffer buffer;
+            buffer.tetrahedra = gen.get_multicolored_tetrahedra(
+                points_view(points),
+                ColorLabelsView(color_labels.data(), color_labels.size()),
+                RadiiView(radii.data(), radii.size()),
+                weighted, alpha
+            );
+            if (!buffer.tetrahedra.empty()) {
+                to_one_based(buffer.tetrahedra.data()->data(), 4 * buffer.tetrahedra.size());
             }
-            return result;
+            return buffer;
         });
 }
@@ -9,23 +9,185 @@ function __init__()
 end
 
 """
-    InterfaceSurface(points, color_labels[, radii]; weighted=true, alpha=true)
+    ComputationStats
+
+Time per stage and work counters of one computation.
+
+# Fields
+- `wall_seconds::Vector{Float64}`, `cpu_seconds::Vector{Float64}`: Per stage (triangulation,
+  extraction, subdivision, sorting); CPU time is process time, including helper threads
+- `points_inserted`, `hidden_points`, `finite_cells`, `multicolored_cells`: Cell and point counts
+- `cells_by_partition::Vector{Int}`: Multicolored cells of types 2-2, 3-1, 2-1-1 and 1-1-1-1
+- `simplex_hits`, `simplex_misses`: Subdivision simplices found in or added to the simplex table
+- `simplices_by_dimension::Vector{Int}`: Output vertices, edges and triangles
+- `predicates`: Evaluations, interval filter failures and exactly degenerate results of the
+  `orientation` and `insphere` predicates, re-evaluated on the final triangulation; zero
+  unless enabled with `set_stats_options(gen; predicates = true)`
+- `memory`: Estimated bytes of the triangulation, cells, simplex table, filtration and
+  barycenters, their largest sum alive at once (`peak`), and the process's `peak_rss`;
+  zero unless enabled with `set_stats_options(gen; memory = true)`
+- `allocations`, `allocated_bytes`: Heap allocations per stage; zero unless the library
+  was built with `TRACK_ALLOCATIONS`
+"""
+struct ComputationStats
+    wall_seconds::Vector{Float64}
+    cpu_seconds::Vector{Float64}
+    points_inserted::Int
+    hidden_points::Int
+    finite_cells::Int
+    multicolored_cells::Int
+    cells_by_partition::Vector{Int}
+    simplex_hits::Int
+    simplex_misses::Int
+    simplices_by_dimension::Vector{Int}
+    predicates::NamedTuple{(:orientation, :insphere), NTuple{2, NamedTuple{(:evaluations, :filter_failures, :degenerate), NTuple{3, Int}}}}
+    memory::NamedTuple{(:triangulation, :cells, :simplex_table, :filtration, :barycenters, :peak, :peak_rss), NTuple{7, Int}}
+    allocations::Vector{Int}
+    allocated_bytes::Vector{Int}
+end
+
+# Copies the stats out of `buffers`, or nothing if the computation kept none
+function _stats(buffers)
+    has_stats(buffers) || return nothing
+    stats = computation_stats(buffers)
+    stages = [stage(stats, i) for i in 1:stage_count(stats)]
+    function predicate_counts(index)
+        counts = predicate(stats, index)
+        return (evaluations = evaluations(counts), filter_failures = filter_failures(counts),
+                degenerate = degenerate(counts))
+    end
+    bytes = memory(stats)
+    return ComputationStats(
+        wall_seconds.(stages),
+        cpu_seconds.(stages),
+        points_inserted(stats),
+        hidden_points(stats),
+        finite_cells(stats),
+        multicolored_cells(stats),
+        Vector{Int}(cells_by_partition(stats)),
+        simplex_hits(stats),
+        simplex_misses(stats),
+        Vector{Int}(simplices_by_dimension(stats)),
+        (orientation = predicate_counts(1), insphere = predicate_counts(2)),
+        (triangulation = triangulation_bytes(bytes), cells = cells_bytes(bytes),
+         simplex_table = simplex_table_bytes(bytes), filtration = filtration_bytes(bytes),
+         barycenters = barycenter_bytes(bytes), peak = peak_bytes(bytes), peak_rss = peak_rss_bytes(bytes)),
+        allocations.(stages),
+        allocated_bytes.(stages)
+    )
+end
+
+"""
+    InterfaceSurface
+
+Interface surface of a colored point cloud. The arrays wrap the buffers of the
+C++ computation without copying; indices are 1-based.
+
+# Fields
+- `vertices::Matrix{Float64}`: 3×M barycenters
+- `generators::Matrix{Int32}`: 4×M input points generating each vertex (0 = unused)
+- `vertex_values::Vector{Float64}`: Filtration value of each vertex
+- `edges::Matrix{Int32}`: 2×E vertex columns of each edge, in filtration order
+- `edge_values::Vector{Float64}`: Filtration value of each edge
+- `triangles::Matrix{Int32}`: 3×T vertex columns of each interface triangle, in filtration order
+- `triangle_values::Vector{Float64}`: Filtration value of each triangle
+- `weighted::Bool`, `alpha::Bool`: Complex the surface was computed from
+- `stats::Union{ComputationStats, Nothing}`: Stage times and counters of the computation, if
+  enabled with `set_stats_options`
+"""
+struct InterfaceSurface
+    vertices::Matrix{Float64}
+    generators::Matrix{Int32}
+    vertex_values::Vector{Float64}
+    edges::Matrix{Int32}
+    edge_values::Vector{Float64}
+    triangles::Matrix{Int32}
+    triangle_values::Vector{Float64}
+    weighted::Bool
+    alpha::Bool
+    stats::Union{ComputationStats, Nothing}
+end
+
+# Julia array over memory owned by the C++ object `owner`. The finalizer
+# closure keeps `owner` reachable for as long as the array is.
+function _keep_alive(array, owner)
+    finalizer(_ -> owner, array)
+    return array
+end
+
+function _surface(buffers)
+    InterfaceSurface(
+        _keep_alive(vertices_buffer(buffers), buffers),
+        _keep_alive(generators_buffer(buffers), buffers),
+        _keep_alive(vertex_values_buffer(buffers), buffers),
+        _keep_alive(edges_buffer(buffers), buffers),
+        _keep_alive(edge_values_buffer(buffers), buffers),
+        _keep_alive(triangles_buffer(buffers), buffers),
+        _keep_alive(triangle_values_buffer(buffers), buffers),
+        is_weighted(buffers),
+        is_alpha(buffers),
+        _stats(buffers)
+    )
+end
+
+"""
+    set_stats_options(gen; enabled=true, memory=false, predicates=false)
+
+Record stage times and work counters in the `stats` of the surfaces `gen` computes. With
+`memory` also the memory estimates, which take another pass over the simplices, and with
+`predicates` the predicate counts, which take another pass over the triangulation.
+Off by default.
+"""
+set_stats_options(gen::InterfaceGenerator; enabled::Bool = true, memory::Bool = false, predicates::Bool = false) =
+    set_stats_options(gen, enabled, memory, predicates)
+
+# 3×N Matrix{Float64} inputs are passed to C++ as they are; other layouts are converted
+_points(points::Matrix{Float64}) = _check_points(points)
+_points(points::AbstractMatrix{<:Real}) = _check_points(Matrix{Float64}(points))
+_points(points::AbstractVector{<:AbstractVector{<:Real}}) =
+    _check_points(isempty(points) ? zeros(3, 0) : reduce(hcat, map(p -> Vector{Float64}(p), points)))
+
+function _check_points(points::Matrix{Float64})
+    size(points, 1) == 3 || throw(ArgumentError("points must be a 3×N matrix"))
+    return points
+end
+
+const _Points = Union{AbstractMatrix{<:Real}, AbstractVector{<:AbstractVector{<:Real}}}
+
+"""
+    compute_interface_surface(gen, points, color_labels[, radii]; weighted=true, alpha=true)
 
 Compute the interface surface from a colored point cloud.
 
 # Arguments
-- `points::Vector{Vector{Float64}}`: Vector of 3D points
-- `color_labels::Vector{Int}`: Color label for each point
-- `radii::Vector{Float64}`: Radius for each point (optional, required if weighted=true)
+- `points`: 3×N matrix (passed without copying if a `Matrix{Float64}`), or a vector of 3D points
+- `color_labels::AbstractVector{<:Integer}`: Color label for each point
+- `radii::AbstractVector{<:Real}`: Radius for each point (required if weighted=true)
 - `weighted::Bool`: Use weighted Delaunay/alpha complex (default: true)
 - `alpha::Bool`: Use alpha complex vs Delaunay complex (default: true)
+"""
+function compute_interface_surface(
+    gen::InterfaceGenerator,
+    points::_Points,
+    color_labels::AbstractVector{<:Integer},
+    radii::AbstractVector{<:Real} = Float64[];
+    weighted::Bool = true,
+    alpha::Bool = true
+)
+    buffers = compute_surface_buffers(
+        gen, _points(points), convert(Vector{Int32}, color_labels), convert(Vector{Float64}, radii),
+        weighted, alpha)
+    return _surface(buffers)
+end
 
-# Returns
-- `InterfaceSurface`: Object containing vertices and filtration
+"""
+    InterfaceSurface(points, color_labels[, radii]; weighted=true, alpha=true)
+
+Compute the interface surface from a colored point cloud with a new generator.
 
 # Examples
 ```julia
-points = [[0.0, 0.0, 0.0], [1.0, 0.0, 0.0], [0.0, 1.0, 0.0], [0.0, 0.0, 1.0]]
+points = [0.0 1.0 0.0 0.0; 0.0 0.0 1.0 0.0; 0.0 0.0 0.0 1.0]  # 3×4
 colors = [1, 1, 2, 2]
 radii = [0.5, 0.5, 0.5, 0.5]
 
@@ -33,42 +195,97 @@ surface = InterfaceSurface(points, colors, radii)
 ```
 """
 function InterfaceSurface(
-    points::Vector{Vector{Float64}},
-    color_labels::Vector{Int},
-    radii::Vector{Float64} = Float64[];
+    points::_Points,
+    color_labels::AbstractVector{<:Integer},
+    radii::AbstractVector{<:Real} = Float64[];
+    weighted::Bool = true,
+    alpha::Bool = true
+)
+    return compute_interface_surface(InterfaceGenerator(), points, color_labels, radii;
+                                     weighted = weighted, alpha = alpha)
+end
+
+"""
+    filtration(surface)
+
+The filtration as a vector of `(simplex, value)` pairs, ordered by dimension and
+then value, with 1-based vertex columns.
+"""
+function filtration(surface::InterfaceSurface)
+    result = Tuple{Vector{Int32}, Float64}[]
+    sizehint!(result, length(surface.vertex_values) + length(surface.edge_values) + length(surface.triangle_values))
+    for v in sortperm(surface.vertex_values)
+        push!(result, (Int32[v], surface.vertex_values[v]))
+    end
+    for (simplices, values) in ((surface.edges, surface.edge_values), (surface.triangles, surface.triangle_values))
+        for i in eachindex(values)
+            push!(result, (simplices[:, i], values[i]))
+        end
+    end
+    return result
+end
+
+"""
+    get_barycentric_subdivision_and_filtration(points, color_labels[, radii, weighted, alpha])
+
+Returns the 3×M vertex matrix and the filtration of the interface surface.
+"""
+function get_barycentric_subdivision_and_filtration(
+    points::_Points,
+    color_labels::AbstractVector{<:Integer},
+    radii::AbstractVector{<:Real} = Float64[],
     weighted::Bool = true,
     alpha::Bool = true
 )
-    gen = InterfaceGenerator()
-    return compute_interface_surface(gen, points, color_labels, radii, weighted, alpha)
+    surface = InterfaceSurface(points, color_labels, radii; weighted = weighted, alpha = alpha)
+    return surface.vertices, filtration(surface)
 end
 
 """
-    get_multicolored_tetrahedra(points, color_labels[, radii]; weighted=true, alpha=true)
+    get_multicolored_tetrahedra(gen, points, color_labels[, radii]; weighted=true, alpha=true)
 
 Get all multicolored tetrahedra from the Delaunay/alpha complex.
 
 # Returns
-- Matrix where each row is a tetrahedron with 4 vertex indices [v0, v1, v2, v3]
+- 4×K `Matrix{Int32}` with the 1-based point indices of each tetrahedron
 """
-function get_multicolored_tetrahedra_wrapper(
-    points::Vector{Vector{Float64}},
-    color_labels::Vector{Int},
-    radii::Vector{Float64} = Float64[];
+function get_multicolored_tetrahedra(
+    gen::InterfaceGenerator,
+    points::_Points,
+    color_labels::AbstractVector{<:Integer},
+    radii::AbstractVector{<:Real} = Float64[];
     weighted::Bool = true,
     alpha::Bool = true
 )
-    gen = InterfaceGenerator()
-    flat_result = get_multicolored_tetrahedra(gen, points, color_labels, radii, weighted, alpha)
+    buffer = multicolored_tetrahedra_buffer(
+        gen, _points(points), convert(Vector{Int32}, color_labels), convert(Vector{Float64}, radii),
+        weighted, alpha)
+    return _keep_alive(tetrahedra_buffer(buffer), buffer)
+end
 
-    # Reshape flat array into matrix where each row is a tetrahedron
-    if isempty(flat_result)
-        return Matrix{Int}(undef, 0, 4)
-    end
-    return reshape(flat_result, 4, :)'
+"""
+    get_multicolored_tetrahedra_wrapper(points, color_labels[, radii]; weighted=true, alpha=true)
+
+Get all multicolored tetrahedra from the Delaunay/alpha complex.
+
+# Returns
+- Matrix where each row is a tetrahedron with 4 vertex indices [v0, v1, v2, v3] (0-based)
+"""
+function get_multicolored_tetrahedra_wrapper(
+    points::_Points,
+    color_labels::AbstractVector{<:Integer},
+    radii::AbstractVector{<:Real} = Float64[];
+    weighted::Bool = true,
+    alpha::Bool = true
+)
+    tetrahedra = get_multicolored_tetrahedra(InterfaceGenerator(), points, color_labels, radii;
+                                             weighted = weighted, alpha = alpha)
+    return permutedims(tetrahedra) .- Int32(1)
 end
 
-export InterfaceSurface, InterfaceGenerator
+export InterfaceSurface, InterfaceGenerator, ComputationStats
+export compute_interface_surface, get_multicolored_tetrahedra, filtration, set_stats_options
+export get_barycentric_subdivision_and_filtration
 export get_multicolored_tetrahedra_wrapper
 
 end # module
@@ -10,7 +10,40 @@ from .delaunay_interfaces import (
     InterfaceGenerator,
     InterfaceSurface,
     ComplexConfig,
+    ComputationStage,
+    Progress,
+    OperationCancelled,
+    PartitionType,
+    PredicateType,
+    StageTiming,
+    PredicateStats,
+    MemoryStats,
+    ComputationStats,
+    PreflightEstimate,
+    allocation_tracking_enabled,
+    TraceRecorder,
+    CheckpointOptions,
+    StatsOptions,
     get_barycentric_subdivision_and_filtration,
+    compute_interface_surfaces,
+    compute_interface_surfaces_concatenated,
+    write_ply,
+    write_obj,
+    SurfaceEncoding,
+    SerializationOptions,
+    serialize_interface_surface,
+    deserialize_interface_surface,
+    save_interface_surface,
+    load_interface_surface,
+    StructureFormat,
+    ColoringScheme,
+    StructureReadOptions,
+    StructureData,
+    read_structure,
+    get_vdw_radius,
+    TrajectoryOptions,
+    TrajectoryFrame,
+    process_trajectory,
     __version__
 )
 
@@ -18,5 +51,38 @@ __all__ = [
     'InterfaceGenerator',
     'InterfaceSurface',
     'ComplexConfig',
+    'ComputationStage',
+    'Progress',
+    'OperationCancelled',
+    'PartitionType',
+    'PredicateType',
+    'StageTiming',
+    'PredicateStats',
+    'MemoryStats',
+    'ComputationStats',
+    'PreflightEstimate',
+    'allocation_tracking_enabled',
+    'TraceRecorder',
+    'CheckpointOptions',
+    'StatsOptions',
     'get_barycentric_subdivision_and_filtration',
+    'compute_interface_surfaces',
+    'compute_interface_surfaces_concatenated',
+    'write_ply',
+    'write_obj',
+    'SurfaceEncoding',
+    'SerializationOptions',
+    'serialize_interface_surface',
+    'deserialize_interface_surface',
+    'save_interface_surface',
+    'load_interface_surface',
+    'StructureFormat',
+    'ColoringScheme',
+    'StructureReadOptions',
+    'StructureData',
+    'read_structure',
+    'get_vdw_radius',
+    'TrajectoryOptions',
+    'TrajectoryFrame',
+    'process_trajectory',
 ]
@@ -1,44 +1,382 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include <pybind11/eigen.h>
+#include <pybind11/numpy.h>
 #include "delaunay_interfaces/interface_generation.hpp"
 #include "delaunay_interfaces/barycentric_subdivision.hpp"
+#include "delaunay_interfaces/mesh_export.hpp"
+#include "delaunay_interfaces/structure_io.hpp"
+#include "delaunay_interfaces/trajectory.hpp"
+#include "delaunay_interfaces/serialization.hpp"
+#include "delaunay_interfaces/filtration_arrays.hpp"
+#include "delaunay_interfaces/batch.hpp"
+#include "delaunay_interfaces/preflight.hpp"
 
 namespace py = pybind11;
 using namespace delaunay_interfaces;
 
+namespace {
+
+// Input arrays. C-contiguous arrays of the matching dtype are viewed in place;
+// anything else (float32, strided arrays, nested lists) is converted once by NumPy.
+// The computations read the buffers with the GIL released, so callers must not
+// modify the arrays from other threads until the call returns.
+using PointsArray = py::array_t<double, py::array::c_style | py::array::forcecast>;
+using LabelsArray = py::array_t<int, py::array::c_style | py::array::forcecast>;
+using RadiiArray = py::array_t<double, py::array::c_style | py::array::forcecast>;
+
+PointsView points_view(const PointsArray& points) {
+    if (points.size() == 0) {
+        return {};
+    }
+    if (points.ndim() != 2 || points.shape(1) != 3) {
+        throw std::invalid_argument("points must have shape (N, 3)");
+    }
+    return PointsView(points.data(), points.shape(0));
+}
+
+template<typename T>
+ArrayView<T> array_view(const py::array_t<T, py::array::c_style | py::array::forcecast>& values, const char* name) {
+    if (values.size() == 0) {
+        return {};
+    }
+    if (values.ndim() != 1) {
+        throw std::invalid_argument(std::string(name) + " must be one-dimensional");
+    }
+    return ArrayView<T>(values.data(), values.shape(0));
+}
+
+// Output arrays. Results are moved into a heap object that the array owns
+// through a capsule, so NumPy uses the C++ buffer directly.
+template<typename T>
+py::array_t<T> owning_array(std::vector<T>&& values, std::vector<py::ssize_t> shape) {
+    auto* owner = new std::vector<T>(std::move(values));
+    py::capsule free_when_done(owner, [](void* p) { delete static_cast<std::vector<T>*>(p); });
+    return py::array_t<T>(shape, owner->data(), free_when_done);
+}
+
+// Vectors of fixed-size rows (Point3D, Tetrahedron) become (N, Columns) arrays
+template<typename Scalar, py::ssize_t Columns, typename Row>
+py::array_t<Scalar> owning_rows(std::vector<Row>&& rows) {
+    static_assert(sizeof(Row) == Columns * sizeof(Scalar), "Rows must be packed");
+    auto* owner = new std::vector<Row>(std::move(rows));
+    py::capsule free_when_done(owner, [](void* p) { delete static_cast<std::vector<Row>*>(p); });
+    return py::array_t<Scalar>(
+        {static_cast<py::ssize_t>(owner->size()), Columns},
+        reinterpret_cast<const Scalar*>(owner->data()),
+        free_when_done);
+}
+
+// Read-only (N, Columns) array viewing rows held by a bound object, keeping it alive
+template<typename Scalar, py::ssize_t Columns, typename Row>
+py::array_t<Scalar> row_view(const std::vector<Row>& rows, py::handle owner) {
+    static_assert(sizeof(Row) == Columns * sizeof(Scalar), "Rows must be packed");
+    py::array_t<Scalar> view(
+        {static_cast<py::ssize_t>(rows.size()), Columns},
+        reinterpret_cast<const Scalar*>(rows.data()),
+        owner);
+    // Arrays with a base are writeable, which would let Python edit the surface
+    view.attr("flags").attr("writeable") = false;
+    return view;
+}
+
+// Progress callback that may be copied into and released on threads without
+// the GIL, so the Python function is only touched while holding it
+ProgressCallback python_progress_callback(py::function callback) {
+    struct Holder {
+        py::function function;
+        ~Holder() {
+            py::gil_scoped_acquire acquire;
+            function = py::function();
+        }
+    };
+    auto holder = std::make_shared<Holder>();
+    holder->function = std::move(callback);
+
+    return [holder](const Progress& progress) {
+        py::gil_scoped_acquire acquire;
+        // Lets Ctrl-C interrupt long computations
+        if (PyErr_CheckSignals() != 0) {
+            throw py::error_already_set();
+        }
+        py::object result = holder->function(progress);
+        return result.is_none() || result.cast<bool>();
+    };
+}
+
+} // namespace
+
 PYBIND11_MODULE(delaunay_interfaces, m) {
     m.doc() = "DelaunayInterfaces: Compute interface surfaces from multicolored point clouds";
 
     // Bind InterfaceSurface
     py::class_<InterfaceSurface>(m, "InterfaceSurface")
         .def(py::init<>())
-        .def_readonly("vertices", &InterfaceSurface::vertices,
-            "List of barycenter vertices (3D points)")
+        .def_property_readonly("vertices",
+            [](py::object self) {
+                return row_view<double, 3>(self.cast<const InterfaceSurface&>().vertices, self);
+            },
+            "(M, 3) array of barycenter vertices")
         .def_readonly("filtration", &InterfaceSurface::filtration,
             "List of (simplex, filtration_value) tuples")
         .def_readonly("weighted", &InterfaceSurface::weighted,
             "Whether weighted Delaunay/alpha complex was used")
         .def_readonly("alpha", &InterfaceSurface::alpha,
-            "Whether alpha complex was used");
+            "Whether alpha complex was used")
+        .def_property_readonly("generators",
+            [](py::object self) {
+                return row_view<int, 4>(self.cast<const InterfaceSurface&>().generators, self);
+            },
+            "(M, 4) array of input point indices generating each vertex (padded with -1)")
+        .def_readonly("stats", &InterfaceSurface::stats,
+            "ComputationStats of the computation, or None if stats were off or the surface was loaded")
+        .def("filtration_arrays",
+            [](const InterfaceSurface& surface) {
+                FiltrationArrays arrays;
+                {
+                    py::gil_scoped_release release;
+                    arrays = get_filtration_arrays(surface);
+                }
+                py::ssize_t num_edges = arrays.edge_values.size();
+                py::ssize_t num_triangles = arrays.triangle_values.size();
+                py::dict result;
+                result["vertex_values"] = owning_array(std::move(arrays.vertex_values), {static_cast<py::ssize_t>(surface.vertices.size())});
+                result["edges"] = owning_array(std::move(arrays.edges), {num_edges, 2});
+                result["edge_values"] = owning_array(std::move(arrays.edge_values), {num_edges});
+                result["triangles"] = owning_array(std::move(arrays.triangles), {num_triangles, 3});
+                result["triangle_values"] = owning_array(std::move(arrays.triangle_values), {num_triangles});
+                return result;
+            },
+            "The filtration split by dimension into arrays\n\n"
+            "Returns a dict with vertex_values (M,), edges (E, 2), edge_values (E,),\n"
+            "triangles (T, 3) and triangle_values (T,). Simplices hold 0-based rows\n"
+            "of vertices and keep their filtration order within each dimension.");
+
+    // Progress
+    py::enum_<ComputationStage>(m, "ComputationStage")
+        .value("Triangulation", ComputationStage::Triangulation)
+        .value("Extraction", ComputationStage::Extraction)
+        .value("Subdivision", ComputationStage::Subdivision)
+        .value("Sorting", ComputationStage::Sorting);
+
+    py::class_<Progress>(m, "Progress")
+        .def_readonly("stage", &Progress::stage)
+        .def_readonly("done", &Progress::done)
+        .def_readonly("total", &Progress::total)
+        .def("__repr__", [](const Progress& progress) {
+            return "<Progress " + py::repr(py::cast(progress.stage)).cast<std::string>() + " " +
+                   std::to_string(progress.done) + "/" + std::to_string(progress.total) + ">";
+        });
+
+    py::register_exception<OperationCancelled>(m, "OperationCancelled", PyExc_RuntimeError);
+
+    // Stats
+    py::enum_<PartitionType>(m, "PartitionType")
+        .value("TwoTwo", PartitionType::TwoTwo)
+        .value("ThreeOne", PartitionType::ThreeOne)
+        .value("TwoOneOne", PartitionType::TwoOneOne)
+        .value("OneOneOneOne", PartitionType::OneOneOneOne);
+
+    py::enum_<PredicateType>(m, "PredicateType")
+        .value("Orientation", PredicateType::Orientation)
+        .value("InSphere", PredicateType::InSphere);
+
+    py::class_<StageTiming>(m, "StageTiming")
+        .def_readonly("wall_seconds", &StageTiming::wall_seconds)
+        .def_readonly("cpu_seconds", &StageTiming::cpu_seconds,
+            "Process CPU time, including helper threads and overlapping stages")
+        .def_readonly("allocations", &StageTiming::allocations,
+            "Process-wide heap allocations; 0 unless built with TRACK_ALLOCATIONS")
+        .def_readonly("allocated_bytes", &StageTiming::allocated_bytes);
+
+    py::class_<MemoryStats>(m, "MemoryStats",
+        "Estimated heap bytes of the internal structures, each at its largest")
+        .def_readonly("triangulation_bytes", &MemoryStats::triangulation_bytes)
+        .def_readonly("cells_bytes", &MemoryStats::cells_bytes)
+        .def_readonly("simplex_table_bytes", &MemoryStats::simplex_table_bytes)
+        .def_readonly("filtration_bytes", &MemoryStats::filtration_bytes)
+        .def_readonly("barycenter_bytes", &MemoryStats::barycenter_bytes)
+        .def_readonly("peak_bytes", &MemoryStats::peak_bytes,
+            "Largest sum of the structures alive at once")
+        .def_readonly("peak_rss_bytes", &MemoryStats::peak_rss_bytes,
+            "Peak resident set of the process; 0 if unknown");
+
+    py::class_<PredicateStats>(m, "PredicateStats",
+        "Predicates re-evaluated on the final triangulation")
+        .def_readonly("evaluations", &PredicateStats::evaluations)
+        .def_readonly("filter_failures", &PredicateStats::filter_failures,
+            "Undecided by interval arithmetic, so evaluated exactly")
+        .def_readonly("degenerate", &PredicateStats::degenerate,
+            "Exactly zero: flat cells, or five points on one sphere");
+
+    py::class_<ComputationStats>(m, "ComputationStats",
+        "Time per stage and work counters of one computation")
+        .def_property_readonly("stages",
+            [](const ComputationStats& stats) {
+                py::dict result;
+                for (auto stage : {ComputationStage::Triangulation, ComputationStage::Extraction,
+                                   ComputationStage::Subdivision, ComputationStage::Sorting}) {
+                    result[py::cast(stage)] = stats.stage(stage);
+                }
+                return result;
+            },
+            "Dict of ComputationStage to StageTiming")
+        .def_readonly("points_inserted", &ComputationStats::points_inserted)
+        .def_readonly("hidden_points", &ComputationStats::hidden_points,
+            "Points without a vertex: duplicates, or weighted points hidden by others")
+        .def_readonly("finite_cells", &ComputationStats::finite_cells)
+        .def_readonly("multicolored_cells", &ComputationStats::multicolored_cells)
+        .def_property_readonly("cells_by_partition",
+            [](const ComputationStats& stats) {
+                py::dict result;
+                for (auto type : {PartitionType::TwoTwo, PartitionType::ThreeOne,
+                                  PartitionType::TwoOneOne, PartitionType::OneOneOneOne}) {
+                    result[py::cast(type)] = stats.cells_by_partition[static_cast<size_t>(type)];
+                }
+                return result;
+            },
+            "Dict of PartitionType to the number of multicolored cells")
+        .def_readonly("simplex_hits", &ComputationStats::simplex_hits)
+        .def_readonly("simplex_misses", &ComputationStats::simplex_misses)
+        .def_readonly("simplices_by_dimension", &ComputationStats::simplices_by_dimension,
+            "Output [vertices, edges, triangles]")
+        .def_property_readonly("predicates",
+            [](const ComputationStats& stats) {
+                py::dict result;
+                for (auto type : {PredicateType::Orientation, PredicateType::InSphere}) {
+                    result[py::cast(type)] = stats.predicates[static_cast<size_t>(type)];
+                }
+                return result;
+            },
+            "Dict of PredicateType to PredicateStats")
+        .def_readonly("memory", &ComputationStats::memory);
+
+    py::class_<PreflightEstimate>(m, "PreflightEstimate",
+        "Expected output and cost of compute_interface_surface for a whole input")
+        .def_readonly("points", &PreflightEstimate::points)
+        .def_readonly("sampled_points", &PreflightEstimate::sampled_points)
+        .def_readonly("sample_seconds", &PreflightEstimate::sample_seconds,
+            "Time taken by the estimate itself")
+        .def_readonly("exact", &PreflightEstimate::exact,
+            "The input was small enough to compute whole")
+        .def_readonly("finite_cells", &PreflightEstimate::finite_cells)
+        .def_readonly("multicolored_cells", &PreflightEstimate::multicolored_cells)
+        .def_property_readonly("cells_by_partition",
+            [](const PreflightEstimate& estimate) {
+                py::dict result;
+                for (auto type : {PartitionType::TwoTwo, PartitionType::ThreeOne,
+                                  PartitionType::TwoOneOne, PartitionType::OneOneOneOne}) {
+                    result[py::cast(type)] = estimate.cells_by_partition[static_cast<size_t>(type)];
+                }
+                return result;
+            },
+            "Dict of PartitionType to the number of multicolored cells")
+        .def_readonly("simplices_by_dimension", &PreflightEstimate::simplices_by_dimension,
+            "Output [vertices, edges, triangles]")
+        .def_readonly("memory", &PreflightEstimate::memory,
+            "MemoryStats without peak_rss_bytes")
+        .def_readonly("seconds", &PreflightEstimate::seconds)
+        .def_readonly("time_exponent", &PreflightEstimate::time_exponent,
+            "Fitted growth of the time with the number of points");
+
+    m.def("allocation_tracking_enabled", &allocation_tracking_enabled,
+        "Whether the library counts heap allocations (built with TRACK_ALLOCATIONS)");
+
+    py::class_<TraceRecorder, std::shared_ptr<TraceRecorder>>(m, "TraceRecorder",
+        "Collects timed spans of computations for chrome://tracing or Perfetto")
+        .def(py::init<>())
+        .def("write_chrome_trace",
+            py::overload_cast<const std::string&>(&TraceRecorder::write_chrome_trace, py::const_),
+            py::arg("path"),
+            "Write the spans as Chrome trace event JSON")
+        .def("clear", &TraceRecorder::clear)
+        .def("__len__", [](const TraceRecorder& recorder) { return recorder.get_events().size(); });
+
+    // Bind CheckpointOptions
+    py::class_<CheckpointOptions>(m, "CheckpointOptions")
+        .def(py::init<>())
+        .def_readwrite("path", &CheckpointOptions::path,
+            "Base path of the checkpoint files (<path>.tri, <path>.sub); empty disables checkpoints")
+        .def_readwrite("interval", &CheckpointOptions::interval,
+            "Tetrahedra processed between subdivision checkpoints")
+        .def_readwrite("resume", &CheckpointOptions::resume,
+            "Continue from existing checkpoint files");
+
+    // Bind StatsOptions
+    py::class_<StatsOptions>(m, "StatsOptions")
+        .def(py::init<>())
+        .def_readwrite("enabled", &StatsOptions::enabled,
+            "Record stage times and work counters in surface.stats")
+        .def_readwrite("memory", &StatsOptions::memory,
+            "Also estimate the memory of the structures in stats.memory; slower")
+        .def_readwrite("predicates", &StatsOptions::predicates,
+            "Also count predicate filter failures in stats.predicates, in an extra pass\n"
+            "over the final triangulation");
 
     // Bind InterfaceGenerator
-    py::class_<InterfaceGenerator>(m, "InterfaceGenerator")
+    py::class_<InterfaceGenerator>(m, "InterfaceGenerator",
+        "Computes interface surfaces. Computations release the GIL, and one\n"
+        "generator may be shared by several Python threads.")
         .def(py::init<>())
-        .def("compute_interface_surface", &InterfaceGenerator::compute_interface_surface,
+        .def_property("checkpoint_options",
+            &InterfaceGenerator::get_checkpoint_options,
+            &InterfaceGenerator::set_checkpoint_options,
+            "Checkpointing of compute_interface_surface")
+        .def_property("stats_options",
+            &InterfaceGenerator::get_stats_options,
+            &InterfaceGenerator::set_stats_options,
+            "What compute_interface_surface records in surface.stats; nothing by default")
+        .def("set_progress_callback",
+            [](InterfaceGenerator& generator, std::optional<py::function> callback) {
+                generator.set_progress_callback(
+                    callback ? python_progress_callback(std::move(*callback)) : ProgressCallback{});
+            },
+            py::arg("callback"),
+            "Call callback(progress) during computations; None removes it\n\n"
+            "The callback runs at stage boundaries and periodically within stages.\n"
+            "Returning False (or raising) cancels the computation, which then raises\n"
+            "OperationCancelled (or the callback's exception). With a callback set,\n"
+            "Ctrl-C also interrupts the computation.")
+        .def("set_thread_pool",
+            [](InterfaceGenerator& generator, size_t num_threads, std::vector<int> cpu_affinity) {
+                generator.set_executor(
+                    std::make_shared<ThreadPool>(ThreadPoolOptions{num_threads, std::move(cpu_affinity)}));
+            },
+            py::arg("num_threads") = 0,
+            py::arg("cpu_affinity") = std::vector<int>(),
+            "Run the parallel stages of computations on a dedicated thread pool\n\n"
+            "num_threads = 0 uses one thread per core. Worker i is pinned to\n"
+            "cpu_affinity[i % len(cpu_affinity)] on Linux.")
+        .def("clear_thread_pool",
+            [](InterfaceGenerator& generator) { generator.set_executor(nullptr); },
+            "Run computations on the calling thread only (the default)")
+        .def("set_trace_recorder", &InterfaceGenerator::set_trace_recorder,
+            py::arg("recorder"),
+            "Record the stages, chunks and pipeline blocks of computations into\n"
+            "a TraceRecorder; None turns tracing off")
+        .def("get_trace_recorder", &InterfaceGenerator::get_trace_recorder)
+        .def("compute_interface_surface",
+            [](const InterfaceGenerator& generator, const PointsArray& points, const LabelsArray& color_labels,
+               const RadiiArray& radii, bool weighted, bool alpha) {
+                auto points_in = points_view(points);
+                auto labels_in = array_view(color_labels, "color_labels");
+                auto radii_in = array_view(radii, "radii");
+                py::gil_scoped_release release;
+                return generator.compute_interface_surface(points_in, labels_in, radii_in, weighted, alpha);
+            },
             py::arg("points"),
             py::arg("color_labels"),
-            py::arg("radii") = Radii{},
+            py::arg("radii") = RadiiArray(),
             py::arg("weighted") = true,
             py::arg("alpha") = true,
             "Compute the interface surface from colored points\n\n"
             "Parameters\n"
             "----------\n"
-            "points : list of 3D points (numpy arrays or lists)\n"
-            "    The input point cloud\n"
-            "color_labels : list of int\n"
+            "points : (N, 3) array_like of float\n"
+            "    The input point cloud; float64 C-contiguous arrays are not copied\n"
+            "color_labels : (N,) array_like of int\n"
             "    Color label for each point\n"
-            "radii : list of float, optional\n"
+            "radii : (N,) array_like of float, optional\n"
             "    Radius for each point (required if weighted=True)\n"
             "weighted : bool, default=True\n"
             "    Use weighted Delaunay/alpha complex\n"
@@ -48,20 +386,60 @@ PYBIND11_MODULE(delaunay_interfaces, m) {
             "-------\n"
             "InterfaceSurface\n"
             "    The computed interface surface")
-        .def("get_multicolored_tetrahedra", &InterfaceGenerator::get_multicolored_tetrahedra,
+        .def("estimate_interface_surface",
+            [](const InterfaceGenerator& generator, const PointsArray& points, const LabelsArray& color_labels,
+               const RadiiArray& radii, bool weighted, bool alpha, size_t sample_size, size_t windows,
+               uint64_t seed) {
+                auto points_in = points_view(points);
+                auto labels_in = array_view(color_labels, "color_labels");
+                auto radii_in = array_view(radii, "radii");
+                PreflightOptions options;
+                options.sample_size = sample_size;
+                options.windows = windows;
+                options.seed = seed;
+                options.executor = generator.get_executor();
+                py::gil_scoped_release release;
+                return estimate_interface_surface(points_in, labels_in, radii_in, weighted, alpha, options);
+            },
+            py::arg("points"),
+            py::arg("color_labels"),
+            py::arg("radii") = RadiiArray(),
+            py::arg("weighted") = true,
+            py::arg("alpha") = true,
+            py::arg("sample_size") = PreflightOptions().sample_size,
+            py::arg("windows") = PreflightOptions().windows,
+            py::arg("seed") = PreflightOptions().seed,
+            "Estimate the cells, simplices, memory and time of compute_interface_surface\n\n"
+            "Computes the surfaces of `windows` neighbourhoods of random input points,\n"
+            "sample_size points in all, on this generator's thread pool, and\n"
+            "extrapolates them to the whole input. Inputs up to sample_size points\n"
+            "are computed whole. Returns a PreflightEstimate.")
+        .def("get_multicolored_tetrahedra",
+            [](const InterfaceGenerator& generator, const PointsArray& points, const LabelsArray& color_labels,
+               const RadiiArray& radii, bool weighted, bool alpha) {
+                auto points_in = points_view(points);
+                auto labels_in = array_view(color_labels, "color_labels");
+                auto radii_in = array_view(radii, "radii");
+                Tetrahedra tetrahedra;
+                {
+                    py::gil_scoped_release release;
+                    tetrahedra = generator.get_multicolored_tetrahedra(points_in, labels_in, radii_in, weighted, alpha);
+                }
+                return owning_rows<int, 4>(std::move(tetrahedra));
+            },
             py::arg("points"),
             py::arg("color_labels"),
-            py::arg("radii") = Radii{},
+            py::arg("radii") = RadiiArray(),
             py::arg("weighted") = true,
             py::arg("alpha") = true,
             "Get all multicolored tetrahedra from the complex\n\n"
             "Parameters\n"
             "----------\n"
-            "points : list of 3D points\n"
+            "points : (N, 3) array_like of float\n"
             "    The input point cloud\n"
-            "color_labels : list of int\n"
+            "color_labels : (N,) array_like of int\n"
             "    Color label for each point\n"
-            "radii : list of float, optional\n"
+            "radii : (N,) array_like of float, optional\n"
             "    Radius for each point (required if weighted=True)\n"
             "weighted : bool, default=True\n"
             "    Use weighted Delaunay/alpha complex\n"
@@ -69,36 +447,254 @@ PYBIND11_MODULE(delaunay_interfaces, m) {
             "    Use alpha complex (vs Delaunay complex)\n\n"
             "Returns\n"
             "-------\n"
-            "list of arrays\n"
-            "    List of tetrahedra (each is array of 4 vertex indices)");
+            "ndarray of int32, shape (K, 4)\n"
+            "    Input point indices of each tetrahedron");
 
     // Convenience function
     m.def("get_barycentric_subdivision_and_filtration",
-        &get_barycentric_subdivision_and_filtration,
+        [](const PointsArray& points, const LabelsArray& color_labels, const RadiiArray& radii,
+           bool weighted, bool alpha, const CheckpointOptions& checkpoint) {
+            auto points_in = points_view(points);
+            auto labels_in = array_view(color_labels, "color_labels");
+            auto radii_in = array_view(radii, "radii");
+            std::pair<Points, Filtration> result;
+            {
+                py::gil_scoped_release release;
+                result = get_barycentric_subdivision_and_filtration(
+                    points_in, labels_in, radii_in, weighted, alpha, checkpoint);
+            }
+            auto& [vertices, filtration] = result;
+            return py::make_tuple(owning_rows<double, 3>(std::move(vertices)), std::move(filtration));
+        },
         py::arg("points"),
         py::arg("color_labels"),
-        py::arg("radii") = Radii{},
+        py::arg("radii") = RadiiArray(),
         py::arg("weighted") = true,
         py::arg("alpha") = true,
+        py::arg("checkpoint") = CheckpointOptions{},
         "Compute barycentric subdivision and filtration\n\n"
         "Parameters\n"
         "----------\n"
-        "points : list of 3D points\n"
+        "points : (N, 3) array_like of float\n"
         "    The input point cloud\n"
-        "color_labels : list of int\n"
+        "color_labels : (N,) array_like of int\n"
         "    Color label for each point\n"
-        "radii : list of float, optional\n"
+        "radii : (N,) array_like of float, optional\n"
         "    Radius for each point (required if weighted=True)\n"
         "weighted : bool, default=True\n"
         "    Use weighted Delaunay/alpha complex\n"
         "alpha : bool, default=True\n"
-        "    Use alpha complex (vs Delaunay complex)\n\n"
+        "    Use alpha complex (vs Delaunay complex)\n"
+        "checkpoint : CheckpointOptions, optional\n"
+        "    Checkpoint and resume the triangulation and subdivision\n\n"
         "Returns\n"
         "-------\n"
         "tuple of (vertices, filtration)\n"
-        "    vertices: list of barycenter points\n"
+        "    vertices: (M, 3) array of barycenter points\n"
         "    filtration: list of (simplex, filtration_value) tuples");
 
+    // Batches
+    m.def("compute_interface_surfaces",
+        [](py::iterable inputs, bool weighted, bool alpha, size_t num_threads) {
+            // Keep the converted arrays alive while the views are in use
+            std::vector<PointsArray> points;
+            std::vector<LabelsArray> color_labels;
+            std::vector<RadiiArray> radii;
+            std::vector<PointCloud> clouds;
+            for (py::handle item : inputs) {
+                auto input = py::reinterpret_borrow<py::sequence>(item);
+                if (input.size() != 2 && input.size() != 3) {
+                    throw std::invalid_argument("Batch inputs must be (points, color_labels[, radii]) tuples");
+                }
+                points.push_back(input[0].cast<PointsArray>());
+                color_labels.push_back(input[1].cast<LabelsArray>());
+                radii.push_back(input.size() == 3 ? input[2].cast<RadiiArray>() : RadiiArray());
+                clouds.push_back(PointCloud{
+                    points_view(points.back()),
+                    array_view(color_labels.back(), "color_labels"),
+                    array_view(radii.back(), "radii")
+                });
+            }
+
+            BatchOptions options;
+            options.weighted = weighted;
+            options.alpha = alpha;
+            options.num_threads = num_threads;
+            py::gil_scoped_release release;
+            return compute_interface_surfaces(clouds, options);
+        },
+        py::arg("inputs"),
+        py::arg("weighted") = true,
+        py::arg("alpha") = true,
+        py::arg("num_threads") = 0,
+        "Compute the interface surfaces of many point clouds in parallel\n\n"
+        "inputs is an iterable of (points, color_labels) or (points, color_labels, radii)\n"
+        "tuples. The clouds are processed on a work-stealing pool of num_threads\n"
+        "threads (0 = all cores) and the surfaces are returned in input order.");
+
+    m.def("compute_interface_surfaces_concatenated",
+        [](const PointsArray& points, const LabelsArray& color_labels,
+           const py::array_t<int64_t, py::array::c_style | py::array::forcecast>& offsets,
+           const RadiiArray& radii, bool weighted, bool alpha, size_t num_threads) {
+            auto clouds = split_point_clouds(
+                points_view(points), array_view(color_labels, "color_labels"),
+                array_view(radii, "radii"), array_view(offsets, "offsets"));
+
+            BatchOptions options;
+            options.weighted = weighted;
+            options.alpha = alpha;
+            options.num_threads = num_threads;
+            py::gil_scoped_release release;
+            return compute_interface_surfaces(clouds, options);
+        },
+        py::arg("points"),
+        py::arg("color_labels"),
+        py::arg("offsets"),
+        py::arg("radii") = RadiiArray(),
+        py::arg("weighted") = true,
+        py::arg("alpha") = true,
+        py::arg("num_threads") = 0,
+        "Batch version of compute_interface_surface for concatenated point clouds\n\n"
+        "Cloud i consists of rows offsets[i] to offsets[i + 1] of points, color_labels\n"
+        "and radii, so offsets has one entry more than there are clouds.");
+
+    // Mesh export
+    m.def("write_ply", &write_ply, py::call_guard<py::gil_scoped_release>(),
+        py::arg("path"),
+        py::arg("surface"),
+        py::arg("color_labels"),
+        "Write the interface triangles as binary PLY\n\n"
+        "Vertices carry x, y, z and filtration; faces carry vertex_indices,\n"
+        "filtration and the separated color pair (color_a, color_b)");
+
+    m.def("write_obj", &write_obj, py::call_guard<py::gil_scoped_release>(),
+        py::arg("path"),
+        py::arg("surface"),
+        py::arg("color_labels"),
+        "Write the interface triangles as Wavefront OBJ\n\n"
+        "Vertex filtration values are stored as texture coordinates and faces\n"
+        "are grouped by color pair");
+
+    // Serialization
+    py::enum_<SurfaceEncoding>(m, "SurfaceEncoding")
+        .value("Raw", SurfaceEncoding::Raw)
+        .value("Compressed", SurfaceEncoding::Compressed);
+
+    py::class_<SerializationOptions>(m, "SerializationOptions")
+        .def(py::init<>())
+        .def_readwrite("encoding", &SerializationOptions::encoding)
+        .def_readwrite("value_quantum", &SerializationOptions::value_quantum,
+            "Round filtration values to multiples of this (0 = exact)")
+        .def_readwrite("coordinate_quantum", &SerializationOptions::coordinate_quantum,
+            "Round vertex coordinates to multiples of this (0 = exact)");
+
+    m.def("serialize_interface_surface",
+        [](const InterfaceSurface& surface, const SerializationOptions& options) {
+            return py::bytes(serialize_interface_surface(surface, options));
+        },
+        py::arg("surface"),
+        py::arg("options") = SerializationOptions{},
+        "Encode an interface surface as bytes");
+
+    m.def("deserialize_interface_surface",
+        [](py::bytes data) {
+            return deserialize_interface_surface(std::string_view(data));
+        },
+        py::arg("data"),
+        "Decode an interface surface from bytes");
+
+    m.def("save_interface_surface", &save_interface_surface, py::call_guard<py::gil_scoped_release>(),
+        py::arg("path"),
+        py::arg("surface"),
+        py::arg("options") = SerializationOptions{},
+        "Write an interface surface to a binary file");
+
+    m.def("load_interface_surface", &load_interface_surface, py::call_guard<py::gil_scoped_release>(),
+        py::arg("path"),
+        "Read an interface surface from a binary file");
+
+    // Structure input
+    py::enum_<StructureFormat>(m, "StructureFormat")
+        .value("Auto", StructureFormat::Auto)
+        .value("PDB", StructureFormat::PDB)
+        .value("MMCIF", StructureFormat::MMCIF)
+        .value("XYZ", StructureFormat::XYZ)
+        .value("CSV", StructureFormat::CSV);
+
+    py::enum_<ColoringScheme>(m, "ColoringScheme")
+        .value("Chain", ColoringScheme::Chain)
+        .value("Residue", ColoringScheme::Residue)
+        .value("Entity", ColoringScheme::Entity);
+
+    py::class_<StructureReadOptions>(m, "StructureReadOptions")
+        .def(py::init<>())
+        .def_readwrite("format", &StructureReadOptions::format)
+        .def_readwrite("coloring", &StructureReadOptions::coloring)
+        .def_readwrite("include_hetatm", &StructureReadOptions::include_hetatm)
+        .def_readwrite("include_water", &StructureReadOptions::include_water)
+        .def_readwrite("include_hydrogens", &StructureReadOptions::include_hydrogens)
+        .def_readwrite("default_radius", &StructureReadOptions::default_radius,
+            "Radius for elements missing from the van der Waals table")
+        .def_readwrite("radius_offset", &StructureReadOptions::radius_offset,
+            "Added to every radius (e.g. a probe radius)")
+        .def_readwrite("num_threads", &StructureReadOptions::num_threads,
+            "Parser threads (0 = hardware concurrency)");
+
+    py::class_<StructureData>(m, "StructureData")
+        .def_readonly("points", &StructureData::points)
+        .def_readonly("color_labels", &StructureData::color_labels)
+        .def_readonly("radii", &StructureData::radii)
+        .def_readonly("color_names", &StructureData::color_names,
+            "Chain/residue/entity name of each color label");
+
+    m.def("read_structure", &read_structure, py::call_guard<py::gil_scoped_release>(),
+        py::arg("path"),
+        py::arg("options") = StructureReadOptions{},
+        "Read a PDB, mmCIF, XYZ or CSV file into points, color labels and radii\n\n"
+        "Radii are van der Waals radii by element; colors group atoms by chain,\n"
+        "residue or entity as configured in options.coloring");
+
+    m.def("get_vdw_radius", &get_vdw_radius,
+        py::arg("element"),
+        py::arg("fallback") = 1.7,
+        "Bondi van der Waals radius of an element symbol");
+
+    // Trajectories
+    py::class_<TrajectoryOptions>(m, "TrajectoryOptions")
+        .def(py::init<>())
+        .def_readwrite("read_options", &TrajectoryOptions::read_options)
+        .def_readwrite("weighted", &TrajectoryOptions::weighted)
+        .def_readwrite("alpha", &TrajectoryOptions::alpha)
+        .def_readwrite("max_in_flight", &TrajectoryOptions::max_in_flight,
+            "Frames read but not yet written")
+        .def_readwrite("compute_threads", &TrajectoryOptions::compute_threads,
+            "Frames computed concurrently");
+
+    py::class_<TrajectoryFrame>(m, "TrajectoryFrame")
+        .def_readonly("index", &TrajectoryFrame::index)
+        .def_readonly("structure", &TrajectoryFrame::structure)
+        .def_readonly("surface", &TrajectoryFrame::surface);
+
+    m.def("process_trajectory",
+        [](const std::string& path, py::function write_frame, const TrajectoryOptions& options) {
+            // Reading and computing run without the GIL; only the writer needs it
+            // The pipeline frees each frame once it is written, so Python gets
+            // a copy it may keep
+            FrameWriter writer = [&](const TrajectoryFrame& frame) {
+                py::gil_scoped_acquire acquire;
+                write_frame(py::cast(frame, py::return_value_policy::copy));
+            };
+            py::gil_scoped_release release;
+            return process_trajectory(path, writer, options);
+        },
+        py::arg("path"),
+        py::arg("write_frame"),
+        py::arg("options") = TrajectoryOptions{},
+        "Process the frames of a multi-frame PDB or XYZ file as a pipeline\n\n"
+        "Frame k+1 is read while frame k is computed and frame k-1 is passed to\n"
+        "write_frame(frame), which is called in frame order and may keep the\n"
+        "frame. Returns the number of frames processed");
+
     // Version info
     m.attr("__version__") = "0.1.0";
 }
@@ -0,0 +1,42 @@
+#include "delaunay_interfaces/async.hpp"
+#include <memory>
+
+namespace delaunay_interfaces {
+
+std::future<InterfaceSurface> compute_interface_surface_async(
+    const InterfaceGenerator& generator,
+    SurfaceRequest request,
+    Executor& executor
+) {
+    // Shared, since tasks must be copyable
+    auto promise = std::make_shared<std::promise<InterfaceSurface>>();
+    auto shared_request = std::make_shared<SurfaceRequest>(std::move(request));
+    auto shared_generator = std::make_shared<InterfaceGenerator>(generator);
+    auto future = promise->get_future();
+
+    executor.submit([shared_generator, promise, shared_request]() mutable {
+        try {
+            const auto& r = *shared_request;
+            auto surface = shared_generator->compute_interface_surface(
+                r.points, r.color_labels, r.radii, r.weighted, r.alpha);
+            // The generator may own this executor: drop it before the caller can
+            // drop theirs, so a pool is never destroyed by one of its own workers
+            shared_generator.reset();
+            promise->set_value(std::move(surface));
+        } catch (...) {
+            shared_generator.reset();
+            promise->set_exception(std::current_exception());
+        }
+    });
+
+    return future;
+}
+
+std::future<InterfaceSurface> compute_interface_surface_async(
+    const InterfaceGenerator& generator,
+    SurfaceRequest request
+) {
+    return compute_interface_surface_async(generator, std::move(request), default_thread_pool());
+}
+
+} // namespace delaunay_interfaces
@@ -1,14 +1,17 @@
 #include "delaunay_interfaces/barycentric_subdivision.hpp"
 #include "delaunay_interfaces/chromatic_partitioning.hpp"
 #include "delaunay_interfaces/interface_generation.hpp"
+#include "delaunay_interfaces/executor.hpp"
+#include "binary_io.hpp"
 #include <algorithm>
 #include <stdexcept>
+#include <utility>
 
 namespace delaunay_interfaces {
 
 BarycentricSubdivision::BarycentricSubdivision(
-    const Points& points,
-    const ColorLabels& color_labels
+    PointsView points,
+    ColorLabelsView color_labels
 ) : points_(points), color_labels_(color_labels) {}
 
 Partition BarycentricSubdivision::get_chromatic_partitioning(const Tetrahedron& tet) const {
@@ -68,11 +71,28 @@ BarycentricSubdivision::SimplexInfo BarycentricSubdivision::get_or_create_simple
 
     auto it = simplex_map_.find(key);
     if (it != simplex_map_.end()) {
+        ++counters_.simplex_hits;
         return SimplexInfo{it->second.first, it->second.second, false};
     } else {
+        ++counters_.simplex_misses;
         int32_t id = next_simplex_id_++;
         double value = compute_filtration_value(partitioning);
         simplex_map_[key] = {id, value};
+
+        // New simplex: its barycenter becomes vertex `id` of the subdivision
+        Point3D center = Point3D::Zero();
+        for (const auto& part : partitioning) {
+            for (int idx : part) {
+                center += points_[idx];
+            }
+        }
+        barycenters_.push_back(center / static_cast<double>(key.size()));
+
+        GeneratingPoints generating;
+        generating.fill(-1);
+        std::copy(key.begin(), key.end(), generating.begin());
+        generators_.push_back(generating);
+
         return SimplexInfo{id, value, true};
     }
 }
@@ -93,32 +113,11 @@ void BarycentricSubdivision::extend_scaffold_2_2(
     };
 
     std::vector<std::pair<int32_t, double>> vertices;
-    std::vector<bool> created;
 
     // Create or get simplex IDs
     for (const auto& comb : mc_combinations) {
         auto info = get_or_create_simplex(comb);
         vertices.push_back({info.id, info.value});
-        created.push_back(info.newly_created);
-    }
-
-    // Compute new barycenters
-    std::vector<Point3D> new_barycenters(9);
-
-    // Edge barycenters (indices 0-4, 5, 6, 7)
-    for (size_t i = 0; i < mc_combinations.size(); ++i) {
-        std::vector<int> all_vertices;
-        for (const auto& part : mc_combinations[i]) {
-            all_vertices.insert(all_vertices.end(), part.begin(), part.end());
-        }
-        new_barycenters[i] = get_barycenter(all_vertices);
-    }
-
-    // Add newly created barycenters
-    for (size_t i = 0; i < created.size(); ++i) {
-        if (created[i]) {
-            barycenters_.push_back(new_barycenters[i]);
-        }
     }
 
     // Add edges
@@ -170,28 +169,10 @@ void BarycentricSubdivision::extend_scaffold_3_1(
     };
 
     std::vector<std::pair<int32_t, double>> vertices;
-    std::vector<bool> created;
 
     for (const auto& comb : mc_combinations) {
         auto info = get_or_create_simplex(comb);
         vertices.push_back({info.id, info.value});
-        created.push_back(info.newly_created);
-    }
-
-    // Compute barycenters
-    std::vector<Point3D> new_barycenters(7);
-    for (size_t i = 0; i < mc_combinations.size(); ++i) {
-        std::vector<int> all_vertices;
-        for (const auto& part : mc_combinations[i]) {
-            all_vertices.insert(all_vertices.end(), part.begin(), part.end());
-        }
-        new_barycenters[i] = get_barycenter(all_vertices);
-    }
-
-    for (size_t i = 0; i < created.size(); ++i) {
-        if (created[i]) {
-            barycenters_.push_back(new_barycenters[i]);
-        }
     }
 
     // Add edges
@@ -243,27 +224,10 @@ void BarycentricSubdivision::extend_scaffold_2_1_1(
     };
 
     std::vector<std::pair<int32_t, double>> vertices;
-    std::vector<bool> created;
 
     for (const auto& comb : mc_combinations) {
         auto info = get_or_create_simplex(comb);
         vertices.push_back({info.id, info.value});
-        created.push_back(info.newly_created);
-    }
-
-    std::vector<Point3D> new_barycenters(10);
-    for (size_t i = 0; i < mc_combinations.size(); ++i) {
-        std::vector<int> all_vertices;
-        for (const auto& part : mc_combinations[i]) {
-            all_vertices.insert(all_vertices.end(), part.begin(), part.end());
-        }
-        new_barycenters[i] = get_barycenter(all_vertices);
-    }
-
-    for (size_t i = 0; i < created.size(); ++i) {
-        if (created[i]) {
-            barycenters_.push_back(new_barycenters[i]);
-        }
     }
 
     // Add edges (connections between simplices)
@@ -319,27 +283,10 @@ void BarycentricSubdivision::extend_scaffold_1_1_1_1(
     };
 
     std::vector<std::pair<int32_t, double>> vertices;
-    std::vector<bool> created;
 
     for (const auto& comb : mc_combinations) {
         auto info = get_or_create_simplex(comb);
         vertices.push_back({info.id, info.value});
-        created.push_back(info.newly_created);
-    }
-
-    std::vector<Point3D> new_barycenters(11);
-    for (size_t i = 0; i < mc_combinations.size(); ++i) {
-        std::vector<int> all_vertices;
-        for (const auto& part : mc_combinations[i]) {
-            all_vertices.insert(all_vertices.end(), part.begin(), part.end());
-        }
-        new_barycenters[i] = get_barycenter(all_vertices);
-    }
-
-    for (size_t i = 0; i < created.size(); ++i) {
-        if (created[i]) {
-            barycenters_.push_back(new_barycenters[i]);
-        }
     }
 
     // Add edges
@@ -377,65 +324,131 @@ void BarycentricSubdivision::extend_scaffold_1_1_1_1(
 
 void BarycentricSubdivision::process_tetrahedron(const Tetrahedron& tet) {
     auto parts = get_chromatic_partitioning(tet);
+    auto count = [&](PartitionType type) { ++counters_.cells_by_partition[static_cast<size_t>(type)]; };
 
     if (parts.size() == 2) {
         if (parts[0].size() == 2 && parts[1].size() == 2) {
+            count(PartitionType::TwoTwo);
             extend_scaffold_2_2(parts[0], parts[1]);
         } else if (parts[0].size() == 3 && parts[1].size() == 1) {
+            count(PartitionType::ThreeOne);
             extend_scaffold_3_1(parts[0], parts[1]);
         } else if (parts[0].size() == 1 && parts[1].size() == 3) {
+            count(PartitionType::ThreeOne);
             extend_scaffold_3_1(parts[1], parts[0]);
         } else {
             throw std::runtime_error("Invalid 2-part partitioning");
         }
     } else if (parts.size() == 3) {
+        count(PartitionType::TwoOneOne);
         extend_scaffold_2_1_1(parts[0], parts[1], parts[2]);
     } else if (parts.size() == 4) {
+        count(PartitionType::OneOneOneOne);
         extend_scaffold_1_1_1_1(parts[0], parts[1], parts[2], parts[3]);
     }
 }
 
-Filtration BarycentricSubdivision::get_filtration() const {
+Filtration BarycentricSubdivision::get_filtration(Executor* executor) const {
     Filtration result(filtration_set_.begin(), filtration_set_.end());
 
-    // Sort by simplex size, then by filtration value
-    std::sort(result.begin(), result.end(),
+    // Sort by simplex size, then by filtration value. Ties keep the set order,
+    // so the result does not depend on how the sort is split up.
+    parallel_sort(result.begin(), result.end(),
         [](const auto& a, const auto& b) {
             if (std::get<0>(a).size() != std::get<0>(b).size()) {
                 return std::get<0>(a).size() < std::get<0>(b).size();
             }
-            return std::get<1>(a) < std::get<1>(b);
-        }
+            if (std::get<1>(a) != std::get<1>(b)) {
+                return std::get<1>(a) < std::get<1>(b);
+            }
+            return std::get<0>(a) < std::get<0>(b);
+        },
+        executor
     );
 
     return result;
 }
 
-std::pair<Points, Filtration> get_barycentric_subdivision_and_filtration(
-    const Points& points,
-    const ColorLabels& color_labels,
-    const Radii& radii,
-    bool weighted,
-    bool alpha
-) {
-    if (points.size() != color_labels.size()) {
-        throw std::invalid_argument("Each point must have a corresponding color_label");
+BarycentricSubdivision::MemoryUsage BarycentricSubdivision::memory_usage() const {
+    MemoryUsage usage;
+    usage.simplex_table = simplex_map_.size() * tree_node_bytes<decltype(simplex_map_)::value_type>();
+    for (const auto& entry : simplex_map_) {
+        usage.simplex_table += heap_block_bytes(entry.first.capacity() * sizeof(int));
+    }
+    usage.filtration = filtration_set_.size() * tree_node_bytes<SimplexWithFiltration>();
+    for (const auto& simplex : filtration_set_) {
+        usage.filtration += heap_block_bytes(std::get<0>(simplex).capacity() * sizeof(int32_t));
     }
+    usage.barycenters = vector_bytes(barycenters_) + vector_bytes(generators_);
+    return usage;
+}
+
+void BarycentricSubdivision::write_state(std::ostream& out) const {
+    write_binary(out, next_simplex_id_);
 
-    if (weighted && radii.size() != points.size()) {
-        throw std::invalid_argument("Each point must have an assigned radius for weighted complexes");
+    write_binary<uint64_t>(out, barycenters_.size());
+    for (const auto& p : barycenters_) {
+        write_binary_array(out, p.data(), 3);
     }
+    write_binary_vector(out, generators_);
 
-    InterfaceGenerator generator;
-    auto tetrahedra = generator.get_multicolored_tetrahedra(points, color_labels, radii, weighted, alpha);
+    write_binary<uint64_t>(out, simplex_map_.size());
+    for (const auto& [key, entry] : simplex_map_) {
+        write_binary<uint8_t>(out, key.size());
+        write_binary_array(out, key.data(), key.size());
+        write_binary(out, entry.first);
+        write_binary(out, entry.second);
+    }
+
+    write_binary<uint64_t>(out, filtration_set_.size());
+    for (const auto& [simplex, value] : filtration_set_) {
+        write_binary<uint8_t>(out, simplex.size());
+        write_binary_array(out, simplex.data(), simplex.size());
+        write_binary(out, value);
+    }
+}
 
-    BarycentricSubdivision subdivision(points, color_labels);
+void BarycentricSubdivision::read_state(std::istream& in) {
+    next_simplex_id_ = read_binary<int32_t>(in);
 
-    for (const auto& tet : tetrahedra) {
-        subdivision.process_tetrahedron(tet);
+    barycenters_.resize(read_binary_count(in, 3 * sizeof(double)));
+    for (auto& p : barycenters_) {
+        read_binary_array(in, p.data(), 3);
     }
+    generators_ = read_binary_vector<GeneratingPoints>(in);
 
-    return {subdivision.get_barycenters(), subdivision.get_filtration()};
+    // Entries were written in order, so every insertion goes to the end
+    simplex_map_.clear();
+    // A size byte, an id and a value per entry
+    for (uint64_t n = read_binary_count(in, sizeof(uint8_t) + sizeof(int32_t) + sizeof(double)); n > 0; --n) {
+        std::vector<int> key(read_binary<uint8_t>(in));
+        read_binary_array(in, key.data(), key.size());
+        int32_t id = read_binary<int32_t>(in);
+        double value = read_binary<double>(in);
+        simplex_map_.emplace_hint(simplex_map_.end(), std::move(key), std::make_pair(id, value));
+    }
+
+    filtration_set_.clear();
+    for (uint64_t n = read_binary_count(in, sizeof(uint8_t) + sizeof(double)); n > 0; --n) {
+        Simplex simplex(read_binary<uint8_t>(in));
+        read_binary_array(in, simplex.data(), simplex.size());
+        double value = read_binary<double>(in);
+        filtration_set_.emplace_hint(filtration_set_.end(), std::move(simplex), value);
+    }
+}
+
+std::pair<Points, Filtration> get_barycentric_subdivision_and_filtration(
+    PointsView points,
+    ColorLabelsView color_labels,
+    RadiiView radii,
+    bool weighted,
+    bool alpha,
+    const CheckpointOptions& checkpoint
+) {
+    InterfaceGenerator generator;
+    generator.set_checkpoint_options(checkpoint);
+    auto surface = generator.compute_interface_surface(points, color_labels, radii, weighted, alpha);
+    return {std::move(surface.vertices), std::move(surface.filtration)};
 }
 
 } // namespace delaunay_interfaces
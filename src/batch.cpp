@@ -0,0 +1,72 @@
+#include "delaunay_interfaces/batch.hpp"
+#include "delaunay_interfaces/interface_generation.hpp"
+#include <stdexcept>
+#include <string>
+
+namespace delaunay_interfaces {
+
+std::vector<InterfaceSurface> compute_interface_surfaces(
+    const std::vector<PointCloud>& inputs,
+    const BatchOptions& options
+) {
+    ThreadPool pool(options.num_threads);
+    return compute_interface_surfaces(inputs, pool, options);
+}
+
+std::vector<InterfaceSurface> compute_interface_surfaces(
+    const std::vector<PointCloud>& inputs,
+    Executor& executor,
+    const BatchOptions& options
+) {
+    std::vector<InterfaceSurface> surfaces(inputs.size());
+    const InterfaceGenerator generator;
+
+    // Small inputs take microseconds each, so items are handed out in chunks
+    executor.parallel_for(inputs.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const auto& input = inputs[i];
+            surfaces[i] = generator.compute_interface_surface(
+                input.points, input.color_labels, input.radii, options.weighted, options.alpha);
+        }
+    });
+
+    return surfaces;
+}
+
+std::vector<PointCloud> split_point_clouds(
+    PointsView points,
+    ColorLabelsView color_labels,
+    RadiiView radii,
+    ArrayView<int64_t> offsets
+) {
+    if (color_labels.size() != points.size()) {
+        throw std::invalid_argument("Each point must have a corresponding color_label");
+    }
+    if (!radii.empty() && radii.size() != points.size()) {
+        throw std::invalid_argument("radii must be empty or have one entry per point");
+    }
+    if (offsets.empty()) {
+        throw std::invalid_argument("offsets must have one entry more than there are point clouds");
+    }
+
+    std::vector<PointCloud> clouds;
+    clouds.reserve(offsets.size() - 1);
+    for (size_t i = 0; i + 1 < offsets.size(); ++i) {
+        int64_t begin = offsets[i];
+        int64_t end = offsets[i + 1];
+        if (begin < 0 || end < begin || static_cast<size_t>(end) > points.size()) {
+            throw std::invalid_argument("offsets must be non-decreasing and within the points (at " +
+                                        std::to_string(i) + ")");
+        }
+
+        size_t size = end - begin;
+        clouds.push_back(PointCloud{
+            PointsView(points.data() + 3 * begin, size),
+            ColorLabelsView(color_labels.data() + begin, size),
+            radii.empty() ? RadiiView() : RadiiView(radii.data() + begin, size)
+        });
+    }
+    return clouds;
+}
+
+} // namespace delaunay_interfaces
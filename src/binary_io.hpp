@@ -0,0 +1,101 @@
+#pragma once
+
+// Internal helpers for native-endian binary files
+
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace delaunay_interfaces {
+
+template<typename T>
+void write_binary(std::ostream& out, const T& value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+void write_binary_array(std::ostream& out, const T* data, size_t count) {
+    out.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(sizeof(T) * count));
+}
+
+template<typename T>
+T read_binary(std::istream& in) {
+    T value;
+    in.read(reinterpret_cast<char*>(&value), sizeof(T));
+    if (!in) {
+        throw std::runtime_error("Unexpected end of binary data");
+    }
+    return value;
+}
+
+template<typename T>
+void read_binary_array(std::istream& in, T* data, size_t count) {
+    in.read(reinterpret_cast<char*>(data), static_cast<std::streamsize>(sizeof(T) * count));
+    if (!in) {
+        throw std::runtime_error("Unexpected end of binary data");
+    }
+}
+
+// A count of elements taking at least `element_bytes` each, checked against
+// the rest of the stream before it sizes an allocation
+inline uint64_t read_binary_count(std::istream& in, size_t element_bytes) {
+    uint64_t count = read_binary<uint64_t>(in);
+    std::streampos position = in.tellg();
+    in.seekg(0, std::ios::end);
+    std::streampos end = in.tellg();
+    in.seekg(position);
+    if (position < 0 || end < 0 || !in) {
+        throw std::runtime_error("Cannot measure binary data");
+    }
+    if (count > static_cast<uint64_t>(end - position) / element_bytes) {
+        throw std::runtime_error("Element count exceeds the binary data");
+    }
+    return count;
+}
+
+// Vector of trivially copyable elements, prefixed by its length
+template<typename T>
+void write_binary_vector(std::ostream& out, const std::vector<T>& values) {
+    write_binary<uint64_t>(out, values.size());
+    write_binary_array(out, values.data(), values.size());
+}
+
+template<typename T>
+std::vector<T> read_binary_vector(std::istream& in) {
+    std::vector<T> values(read_binary_count(in, sizeof(T)));
+    read_binary_array(in, values.data(), values.size());
+    return values;
+}
+
+// Every file starts with an 8-byte tag naming its kind and version
+inline void write_magic(std::ostream& out, const char (&magic)[9]) {
+    out.write(magic, 8);
+}
+
+inline bool read_magic(std::istream& in, const char (&magic)[9]) {
+    char found[8];
+    in.read(found, 8);
+    return in && std::memcmp(found, magic, 8) == 0;
+}
+
+// FNV-1a over 64-bit words
+inline uint64_t hash_bytes(const void* data, size_t size, uint64_t hash = 14695981039346656037ull) {
+    constexpr uint64_t prime = 1099511628211ull;
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t word;
+        std::memcpy(&word, bytes + i, 8);
+        hash = (hash ^ word) * prime;
+    }
+    for (; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * prime;
+    }
+    return hash;
+}
+
+} // namespace delaunay_interfaces
@@ -0,0 +1,244 @@
+#include "delaunay_interfaces/c_api.h"
+#include "delaunay_interfaces/interface_generation.hpp"
+#include "delaunay_interfaces/filtration_arrays.hpp"
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+
+using namespace delaunay_interfaces;
+
+struct di_generator {
+    InterfaceGenerator generator;
+};
+
+struct di_surface {
+    InterfaceSurface surface;
+    FiltrationArrays arrays;
+};
+
+struct di_tetrahedra {
+    Tetrahedra tetrahedra;
+};
+
+namespace {
+
+thread_local std::string last_error;
+
+struct BufferTooSmall : std::runtime_error {
+    using std::runtime_error::runtime_error;
+};
+
+// Runs `body`, turning exceptions into status codes; nothing may unwind into C
+template<typename Body>
+di_status guarded(Body body) {
+    try {
+        last_error.clear();
+        body();
+        return DI_OK;
+    } catch (const std::invalid_argument& e) {
+        last_error = e.what();
+        return DI_INVALID_ARGUMENT;
+    } catch (const BufferTooSmall& e) {
+        last_error = e.what();
+        return DI_BUFFER_TOO_SMALL;
+    } catch (const std::bad_alloc&) {
+        last_error = "Out of memory";
+        return DI_OUT_OF_MEMORY;
+    } catch (const std::exception& e) {
+        last_error = e.what();
+        return DI_RUNTIME_ERROR;
+    } catch (...) {
+        last_error = "Unknown error";
+        return DI_UNKNOWN_ERROR;
+    }
+}
+
+void require(bool condition, const char* message) {
+    if (!condition) {
+        throw std::invalid_argument(message);
+    }
+}
+
+struct Inputs {
+    PointsView points;
+    ColorLabelsView color_labels;
+    RadiiView radii;
+};
+
+Inputs get_inputs(const di_point_cloud* cloud) {
+    require(cloud != nullptr, "points must not be NULL");
+    require(cloud->num_points == 0 || (cloud->xyz && cloud->color_labels),
+            "xyz and color_labels must not be NULL");
+
+    static_assert(sizeof(int32_t) == sizeof(int), "Color labels are passed as int");
+    return Inputs{
+        PointsView(cloud->xyz, cloud->num_points),
+        ColorLabelsView(reinterpret_cast<const int*>(cloud->color_labels), cloud->num_points),
+        cloud->radii ? RadiiView(cloud->radii, cloud->num_points) : RadiiView()
+    };
+}
+
+// Copy `count` rows of `width` indices, shifting 0-based indices to `index_base`
+template<typename T>
+void copy_indices(const T* source, size_t count, size_t width, int32_t index_base, int32_t* target) {
+    std::transform(source, source + count * width, target,
+        [&](T index) { return static_cast<int32_t>(index) + index_base; });
+}
+
+} // namespace
+
+extern "C" {
+
+int di_c_api_version(void) {
+    return DI_C_API_VERSION;
+}
+
+const char* di_last_error_message(void) {
+    return last_error.c_str();
+}
+
+di_status di_generator_create(di_generator** generator) {
+    return guarded([&] {
+        require(generator != nullptr, "generator must not be NULL");
+        *generator = new di_generator();
+    });
+}
+
+void di_generator_destroy(di_generator* generator) {
+    delete generator;
+}
+
+di_status di_compute_interface_surface(
+    const di_generator* generator,
+    const di_point_cloud* points,
+    int weighted,
+    int alpha,
+    di_surface** surface
+) {
+    return guarded([&] {
+        require(generator != nullptr && surface != nullptr, "generator and surface must not be NULL");
+        *surface = nullptr;
+
+        auto inputs = get_inputs(points);
+        auto result = std::make_unique<di_surface>();
+        result->surface = generator->generator.compute_interface_surface(
+            inputs.points, inputs.color_labels, inputs.radii, weighted != 0, alpha != 0);
+        result->arrays = get_filtration_arrays(result->surface);
+        *surface = result.release();
+    });
+}
+
+void di_surface_destroy(di_surface* surface) {
+    delete surface;
+}
+
+di_status di_surface_get_sizes(const di_surface* surface, di_surface_sizes* sizes) {
+    return guarded([&] {
+        require(surface != nullptr && sizes != nullptr, "surface and sizes must not be NULL");
+        sizes->num_vertices = surface->surface.vertices.size();
+        sizes->num_edges = surface->arrays.edge_values.size();
+        sizes->num_triangles = surface->arrays.triangle_values.size();
+    });
+}
+
+di_status di_surface_copy(const di_surface* surface, const di_surface_buffers* buffers) {
+    di_surface_sizes sizes;
+    di_status status = di_surface_get_sizes(surface, &sizes);
+    if (status != DI_OK) return status;
+
+    return guarded([&] {
+        require(buffers != nullptr, "buffers must not be NULL");
+
+        // Check every capacity before writing, so a failed call leaves the buffers untouched
+        bool vertices_fit = sizes.num_vertices <= buffers->vertex_capacity ||
+            !(buffers->vertices || buffers->generators || buffers->vertex_values);
+        bool edges_fit = sizes.num_edges <= buffers->edge_capacity ||
+            !(buffers->edges || buffers->edge_values);
+        bool triangles_fit = sizes.num_triangles <= buffers->triangle_capacity ||
+            !(buffers->triangles || buffers->triangle_values);
+        if (!vertices_fit || !edges_fit || !triangles_fit) {
+            throw BufferTooSmall("Output buffer capacity is below the surface size");
+        }
+
+        const auto& vertices = surface->surface.vertices;
+        const auto& generators = surface->surface.generators;
+        const auto& arrays = surface->arrays;
+        const int32_t base = buffers->index_base;
+
+        if (buffers->vertices && !vertices.empty()) {
+            std::copy_n(vertices.data()->data(), 3 * vertices.size(), buffers->vertices);
+        }
+        if (buffers->generators && !generators.empty()) {
+            // Padding (-1) moves along with the indices, to index_base - 1
+            copy_indices(generators.data()->data(), generators.size(), 4, base, buffers->generators);
+        }
+        if (buffers->vertex_values) {
+            std::copy(arrays.vertex_values.begin(), arrays.vertex_values.end(), buffers->vertex_values);
+        }
+        if (buffers->edges) {
+            copy_indices(arrays.edges.data(), sizes.num_edges, 2, base, buffers->edges);
+        }
+        if (buffers->edge_values) {
+            std::copy(arrays.edge_values.begin(), arrays.edge_values.end(), buffers->edge_values);
+        }
+        if (buffers->triangles) {
+            copy_indices(arrays.triangles.data(), sizes.num_triangles, 3, base, buffers->triangles);
+        }
+        if (buffers->triangle_values) {
+            std::copy(arrays.triangle_values.begin(), arrays.triangle_values.end(), buffers->triangle_values);
+        }
+    });
+}
+
+di_status di_get_multicolored_tetrahedra(
+    const di_generator* generator,
+    const di_point_cloud* points,
+    int weighted,
+    int alpha,
+    di_tetrahedra** tetrahedra
+) {
+    return guarded([&] {
+        require(generator != nullptr && tetrahedra != nullptr, "generator and tetrahedra must not be NULL");
+        *tetrahedra = nullptr;
+
+        auto inputs = get_inputs(points);
+        auto result = std::make_unique<di_tetrahedra>();
+        result->tetrahedra = generator->generator.get_multicolored_tetrahedra(
+            inputs.points, inputs.color_labels, inputs.radii, weighted != 0, alpha != 0);
+        *tetrahedra = result.release();
+    });
+}
+
+void di_tetrahedra_destroy(di_tetrahedra* tetrahedra) {
+    delete tetrahedra;
+}
+
+di_status di_tetrahedra_get_count(const di_tetrahedra* tetrahedra, size_t* count) {
+    return guarded([&] {
+        require(tetrahedra != nullptr && count != nullptr, "tetrahedra and count must not be NULL");
+        *count = tetrahedra->tetrahedra.size();
+    });
+}
+
+di_status di_tetrahedra_copy(
+    const di_tetrahedra* tetrahedra,
+    int32_t* indices,
+    size_t capacity,
+    int32_t index_base
+) {
+    return guarded([&] {
+        require(tetrahedra != nullptr, "tetrahedra must not be NULL");
+        const auto& cells = tetrahedra->tetrahedra;
+        if (cells.empty()) return;
+
+        require(indices != nullptr, "indices must not be NULL");
+        if (capacity < cells.size()) {
+            throw BufferTooSmall("Output buffer capacity is below the number of tetrahedra");
+        }
+        copy_indices(cells.data()->data(), cells.size(), 4, index_base, indices);
+    });
+}
+
+} // extern "C"
@@ -0,0 +1,110 @@
+#include "delaunay_interfaces/checkpoint.hpp"
+#include "delaunay_interfaces/barycentric_subdivision.hpp"
+#include "binary_io.hpp"
+#include <filesystem>
+#include <fstream>
+
+namespace delaunay_interfaces {
+
+namespace {
+
+constexpr char kTriangulationMagic[9] = "DITRI001";
+constexpr char kSubdivisionMagic[9] = "DISUB001";
+
+// Write through a temporary file so an interrupted write keeps the old checkpoint
+template<typename WriteContents>
+void write_atomically(const std::string& path, WriteContents write_contents) {
+    std::string temporary = path + ".tmp";
+    {
+        std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            throw std::runtime_error("Cannot open '" + temporary + "' for writing");
+        }
+        write_contents(out);
+        out.flush();
+        if (!out) {
+            throw std::runtime_error("Failed writing '" + temporary + "'");
+        }
+    }
+    std::filesystem::rename(temporary, path);
+}
+
+} // namespace
+
+uint64_t hash_triangulation_input(
+    PointsView points,
+    RadiiView radii,
+    bool weighted,
+    bool alpha
+) {
+    uint64_t flags = (weighted ? 1 : 0) | (alpha ? 2 : 0);
+    uint64_t hash = hash_bytes(&flags, sizeof(flags));
+    hash = hash_bytes(points.data(), points.size() * sizeof(Point3D), hash);
+    if (weighted) {
+        hash = hash_bytes(radii.data(), radii.size() * sizeof(double), hash);
+    }
+    return hash;
+}
+
+uint64_t hash_subdivision_input(uint64_t triangulation_hash, ColorLabelsView color_labels) {
+    return hash_bytes(color_labels.data(), color_labels.size() * sizeof(int), triangulation_hash);
+}
+
+void save_triangulation(const std::string& path, const TriangulationCells& triangulation) {
+    write_atomically(path, [&](std::ostream& out) {
+        write_magic(out, kTriangulationMagic);
+        write_binary(out, triangulation.input_hash);
+        write_binary_vector(out, triangulation.cells);
+    });
+}
+
+TriangulationCells load_triangulation(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        throw std::runtime_error("Cannot open '" + path + "'");
+    }
+    if (!read_magic(in, kTriangulationMagic)) {
+        throw std::runtime_error("'" + path + "' is not a triangulation file");
+    }
+
+    TriangulationCells triangulation;
+    triangulation.input_hash = read_binary<uint64_t>(in);
+    triangulation.cells = read_binary_vector<Tetrahedron>(in);
+    return triangulation;
+}
+
+void save_subdivision_checkpoint(
+    const std::string& path,
+    uint64_t input_hash,
+    size_t processed,
+    const BarycentricSubdivision& subdivision
+) {
+    write_atomically(path, [&](std::ostream& out) {
+        write_magic(out, kSubdivisionMagic);
+        write_binary(out, input_hash);
+        write_binary<uint64_t>(out, processed);
+        subdivision.write_state(out);
+    });
+}
+
+bool load_subdivision_checkpoint(
+    const std::string& path,
+    uint64_t input_hash,
+    size_t& processed,
+    BarycentricSubdivision& subdivision
+) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in || !read_magic(in, kSubdivisionMagic) || read_binary<uint64_t>(in) != input_hash) {
+        return false;
+    }
+
+    try {
+        processed = read_binary<uint64_t>(in);
+        subdivision.read_state(in);
+    } catch (const std::runtime_error& e) {
+        throw std::runtime_error("Corrupt checkpoint '" + path + "': " + e.what());
+    }
+    return true;
+}
+
+} // namespace delaunay_interfaces
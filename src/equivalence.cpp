@@ -0,0 +1,140 @@
+#include "delaunay_interfaces/equivalence.hpp"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+
+namespace delaunay_interfaces {
+
+namespace {
+
+bool close(double a, double b, double tolerance) {
+    return std::abs(a - b) <= tolerance * std::max({1.0, std::abs(a), std::abs(b)});
+}
+
+template<typename Range>
+std::string format(const Range& values) {
+    std::ostringstream out;
+    out << "(";
+    bool first = true;
+    for (const auto& value : values) {
+        out << (first ? "" : ", ") << value;
+        first = false;
+    }
+    out << ")";
+    return out.str();
+}
+
+std::string format(const Point3D& point) {
+    std::ostringstream out;
+    out.precision(17);
+    out << "(" << point.x() << ", " << point.y() << ", " << point.z() << ")";
+    return out.str();
+}
+
+EquivalenceResult different(const std::string& difference) {
+    return EquivalenceResult{false, difference};
+}
+
+} // namespace
+
+CanonicalSurface canonicalize(const InterfaceSurface& surface, bool by_generators) {
+    const size_t num_vertices = surface.vertices.size();
+    by_generators = by_generators && surface.generators.size() == num_vertices;
+
+    std::vector<size_t> order(num_vertices);
+    std::iota(order.begin(), order.end(), 0);
+    if (by_generators) {
+        std::sort(order.begin(), order.end(), [&](size_t i, size_t j) {
+            return surface.generators[i] < surface.generators[j];
+        });
+    } else {
+        std::sort(order.begin(), order.end(), [&](size_t i, size_t j) {
+            const auto& p = surface.vertices[i];
+            const auto& q = surface.vertices[j];
+            return std::tie(p.x(), p.y(), p.z()) < std::tie(q.x(), q.y(), q.z());
+        });
+    }
+
+    CanonicalSurface canonical;
+    std::vector<int32_t> position(num_vertices);
+    canonical.vertices.reserve(num_vertices);
+    for (size_t k = 0; k < num_vertices; ++k) {
+        position[order[k]] = static_cast<int32_t>(k);
+        canonical.vertices.push_back(surface.vertices[order[k]]);
+        if (by_generators) {
+            canonical.generators.push_back(surface.generators[order[k]]);
+        }
+    }
+
+    // Simplex ids are 1-based vertex positions
+    canonical.simplices.reserve(surface.filtration.size());
+    for (const auto& [simplex, value] : surface.filtration) {
+        Simplex key;
+        key.reserve(simplex.size());
+        for (int32_t id : simplex) {
+            if (id < 1 || static_cast<size_t>(id) > num_vertices) {
+                throw std::invalid_argument("Filtration refers to a vertex the surface does not have");
+            }
+            key.push_back(position[id - 1]);
+        }
+        std::sort(key.begin(), key.end());
+        canonical.simplices.emplace_back(std::move(key), value);
+    }
+    std::sort(canonical.simplices.begin(), canonical.simplices.end());
+    return canonical;
+}
+
+EquivalenceResult compare_surfaces(
+    const InterfaceSurface& a,
+    const InterfaceSurface& b,
+    const EquivalenceOptions& options
+) {
+    if (a.weighted != b.weighted || a.alpha != b.alpha) {
+        return different("Complex types differ");
+    }
+    if (a.vertices.size() != b.vertices.size()) {
+        return different("Vertex counts differ: " + std::to_string(a.vertices.size()) + " vs " +
+                         std::to_string(b.vertices.size()));
+    }
+    if (a.filtration.size() != b.filtration.size()) {
+        return different("Simplex counts differ: " + std::to_string(a.filtration.size()) + " vs " +
+                         std::to_string(b.filtration.size()));
+    }
+
+    const bool by_generators = a.generators.size() == a.vertices.size() &&
+                               b.generators.size() == b.vertices.size();
+    CanonicalSurface ca = canonicalize(a, by_generators);
+    CanonicalSurface cb = canonicalize(b, by_generators);
+
+    for (size_t k = 0; k < ca.vertices.size(); ++k) {
+        if (by_generators && ca.generators[k] != cb.generators[k]) {
+            return different("Vertex " + std::to_string(k) + " has generators " + format(ca.generators[k]) +
+                             " vs " + format(cb.generators[k]));
+        }
+        for (int axis = 0; axis < 3; ++axis) {
+            if (!close(ca.vertices[k][axis], cb.vertices[k][axis], options.coordinate_tolerance)) {
+                return different("Vertex " + std::to_string(k) + " is at " + format(ca.vertices[k]) +
+                                 " vs " + format(cb.vertices[k]));
+            }
+        }
+    }
+
+    for (size_t k = 0; k < ca.simplices.size(); ++k) {
+        const auto& [simplex_a, value_a] = ca.simplices[k];
+        const auto& [simplex_b, value_b] = cb.simplices[k];
+        if (simplex_a != simplex_b) {
+            return different("Simplex " + format(simplex_a) + " vs " + format(simplex_b));
+        }
+        if (!close(value_a, value_b, options.value_tolerance)) {
+            std::ostringstream out;
+            out.precision(17);
+            out << "Filtration value of simplex " << format(simplex_a) << " is " << value_a << " vs " << value_b;
+            return different(out.str());
+        }
+    }
+    return {};
+}
+
+} // namespace delaunay_interfaces
@@ -0,0 +1,92 @@
+#include "delaunay_interfaces/executor.hpp"
+#include "delaunay_interfaces/trace.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+
+namespace delaunay_interfaces {
+
+namespace {
+
+// Shared with the helper tasks, which may start after parallel_for returned
+struct ChunkLoop {
+    explicit ChunkLoop(size_t num_chunks) : num_chunks(num_chunks), error_chunk(num_chunks) {}
+
+    const size_t num_chunks;
+    std::atomic<size_t> next_chunk{0};
+    std::mutex mutex;
+    std::condition_variable finished;
+    size_t done = 0;
+    size_t error_chunk;
+    std::exception_ptr error;
+};
+
+// Claims and runs chunks until none are left. `body` is only used for a
+// claimed chunk, and parallel_for waits for those, so it is still alive.
+void run_chunks(
+    ChunkLoop& loop,
+    const std::function<void(size_t begin, size_t end)>* body,
+    size_t count,
+    size_t grain,
+    TraceRecorder* trace
+) {
+    for (size_t chunk; (chunk = loop.next_chunk.fetch_add(1)) < loop.num_chunks;) {
+        std::exception_ptr chunk_error;
+        try {
+            TraceScope tracing(trace);
+            TraceSpan span("chunk", "executor", static_cast<int64_t>(chunk));
+            (*body)(chunk * grain, std::min(count, (chunk + 1) * grain));
+        } catch (...) {
+            chunk_error = std::current_exception();
+        }
+
+        std::lock_guard<std::mutex> lock(loop.mutex);
+        if (chunk_error && chunk < loop.error_chunk) {
+            loop.error_chunk = chunk;
+            loop.error = chunk_error;
+        }
+        if (++loop.done == loop.num_chunks) {
+            loop.finished.notify_all();
+        }
+    }
+}
+
+} // namespace
+
+void Executor::parallel_for(
+    size_t count,
+    const std::function<void(size_t begin, size_t end)>& body,
+    size_t grain
+) {
+    if (count == 0) return;
+    if (grain == 0) {
+        grain = default_grain(count);
+    }
+
+    const size_t num_chunks = (count + grain - 1) / grain;
+    auto loop = std::make_shared<ChunkLoop>(num_chunks);
+    TraceRecorder* trace = current_trace_recorder();
+
+    // Helpers claim chunks alongside the caller. The caller runs every chunk
+    // no helper has started, so it only waits for chunks already running and
+    // never for tasks the executor has yet to schedule.
+    const size_t num_helpers = std::min(num_chunks - 1, concurrency());
+    for (size_t i = 0; i < num_helpers; ++i) {
+        submit([loop, body = &body, count, grain, trace] {
+            run_chunks(*loop, body, count, grain, trace);
+        });
+    }
+    run_chunks(*loop, &body, count, grain, trace);
+
+    std::unique_lock<std::mutex> lock(loop->mutex);
+    loop->finished.wait(lock, [&] { return loop->done == num_chunks; });
+    // Taken out, so a helper releasing the loop last leaves the exception alone
+    std::exception_ptr error = std::move(loop->error);
+    lock.unlock();
+    if (error) std::rethrow_exception(error);
+}
+
+} // namespace delaunay_interfaces
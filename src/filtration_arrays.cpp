@@ -0,0 +1,49 @@
+#include "delaunay_interfaces/filtration_arrays.hpp"
+#include <stdexcept>
+
+namespace delaunay_interfaces {
+
+FiltrationArrays get_filtration_arrays(const InterfaceSurface& surface) {
+    FiltrationArrays arrays;
+    arrays.vertex_values.assign(surface.vertices.size(), 0.0);
+
+    size_t num_edges = 0;
+    size_t num_triangles = 0;
+    for (const auto& [simplex, value] : surface.filtration) {
+        num_edges += simplex.size() == 2;
+        num_triangles += simplex.size() == 3;
+    }
+    arrays.edges.reserve(2 * num_edges);
+    arrays.edge_values.reserve(num_edges);
+    arrays.triangles.reserve(3 * num_triangles);
+    arrays.triangle_values.reserve(num_triangles);
+
+    // Simplex ids are 1-based vertex positions
+    for (const auto& [simplex, value] : surface.filtration) {
+        for (int32_t id : simplex) {
+            if (id < 1 || static_cast<size_t>(id) > surface.vertices.size()) {
+                throw std::invalid_argument("Filtration refers to a vertex the surface does not have");
+            }
+        }
+
+        switch (simplex.size()) {
+            case 1:
+                arrays.vertex_values[simplex[0] - 1] = value;
+                break;
+            case 2:
+                arrays.edges.insert(arrays.edges.end(), {simplex[0] - 1, simplex[1] - 1});
+                arrays.edge_values.push_back(value);
+                break;
+            case 3:
+                arrays.triangles.insert(arrays.triangles.end(), {simplex[0] - 1, simplex[1] - 1, simplex[2] - 1});
+                arrays.triangle_values.push_back(value);
+                break;
+            default:
+                throw std::invalid_argument("Filtration simplices must have 1 to 3 vertices");
+        }
+    }
+
+    return arrays;
+}
+
+} // namespace delaunay_interfaces
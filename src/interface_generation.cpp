@@ -1,12 +1,25 @@
 #include "delaunay_interfaces/interface_generation.hpp"
 #include "delaunay_interfaces/chromatic_partitioning.hpp"
+#include "delaunay_interfaces/barycentric_subdivision.hpp"
+#include "delaunay_interfaces/bounded_queue.hpp"
 #include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
 #include <CGAL/Delaunay_triangulation_3.h>
 #include <CGAL/Regular_triangulation_3.h>
 #include <CGAL/Alpha_shape_3.h>
 #include <CGAL/Fixed_alpha_shape_3.h>
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Interval_nt.h>
+#include <CGAL/Cartesian_converter.h>
+#include <CGAL/FPU.h>
 #include <set>
 #include <algorithm>
+#include <atomic>
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <stdexcept>
 
 namespace delaunay_interfaces {
 
@@ -28,9 +41,126 @@ using Tds_alpha = CGAL::Triangulation_data_structure_3<Vb_alpha, Fb_alpha>;
 using Triangulation_3 = CGAL::Delaunay_triangulation_3<K, Tds_alpha>;
 using Alpha_shape_3 = CGAL::Alpha_shape_3<Triangulation_3>;
 
+// Interval arithmetic, as in the filters of K's predicates
+using IK = CGAL::Simple_cartesian<CGAL::Interval_nt_advanced>;
+using ToInterval = CGAL::Cartesian_converter<K, IK>;
+
+namespace {
+
+// Inserted and hidden points, and the estimated size of the triangulation
+template<typename Triangulation, typename VertexIndex>
+void record_triangulation(
+    ComputationStats* stats,
+    size_t num_points,
+    const Triangulation& triangulation,
+    const VertexIndex& vertex_to_index
+) {
+    if (!stats) return;
+    stats->points_inserted += num_points;
+    stats->hidden_points += num_points - triangulation.number_of_vertices();
+
+    size_t bytes = triangulation.tds().vertices().capacity() * sizeof(typename Triangulation::Vertex) +
+        triangulation.tds().cells().capacity() * sizeof(typename Triangulation::Cell) +
+        vertex_to_index.size() * tree_node_bytes<typename VertexIndex::value_type>();
+    stats->memory.triangulation_bytes = std::max(stats->memory.triangulation_bytes, bytes);
+}
+
+// Total for the extraction progress. Counting the finite cells is a full
+// pass over the triangulation, so it is skipped when nobody is listening.
+template<typename Triangulation>
+size_t progress_total_cells(const ProgressCallback* progress, const Triangulation& triangulation) {
+    return progress && *progress ? triangulation.number_of_finite_cells() : 0;
+}
+
+// Predicates of `Kernel` on triangulation vertices, weighted or not
+template<typename Kernel>
+struct VertexPredicates {
+    using Point = typename Kernel::Point_3;
+    using Weighted = typename Kernel::Weighted_point_3;
+
+    static const Point& bare(const Point& point) { return point; }
+    static const Point& bare(const Weighted& point) { return point.point(); }
+
+    template<typename P>
+    static auto orientation(const P& p, const P& q, const P& r, const P& s) {
+        return Kernel().orientation_3_object()(bare(p), bare(q), bare(r), bare(s));
+    }
+
+    static auto side_of_sphere(const Point& p, const Point& q, const Point& r, const Point& s, const Point& t) {
+        return Kernel().side_of_oriented_sphere_3_object()(p, q, r, s, t);
+    }
+
+    static auto side_of_sphere(
+        const Weighted& p, const Weighted& q, const Weighted& r, const Weighted& s, const Weighted& t
+    ) {
+        return Kernel().power_side_of_oriented_power_sphere_3_object()(p, q, r, s, t);
+    }
+};
+
+// Counts one evaluation. `approximate` runs on intervals like the filter of
+// the CGAL predicate; `exact` (the filtered predicate of K) only runs where
+// the intervals cannot decide the sign, as it would in CGAL.
+template<typename Approximate, typename Exact>
+void count_predicate(PredicateStats& counts, Approximate approximate, Exact exact) {
+    ++counts.evaluations;
+    bool certain = false;
+    bool zero = false;
+    {
+        CGAL::Protect_FPU_rounding<true> rounding;
+        auto sign = approximate();
+        certain = CGAL::is_certain(sign);
+        zero = certain && CGAL::get_certain(sign) == CGAL::ZERO;
+    }
+    if (!certain) {
+        ++counts.filter_failures;
+        zero = exact() == CGAL::ZERO;
+    }
+    if (zero) ++counts.degenerate;
+}
+
+// Filter failures and degenerate configurations, counted by evaluating the
+// cell orientations and the in-sphere tests across interior facets of the
+// final triangulation again. CGAL does not count them during insertion, and
+// the kernel's predicates are not meant to be wrapped, so this is a separate
+// untimed pass after the triangulation stage.
+template<typename Triangulation>
+void record_predicates(ComputationStats* stats, const Triangulation& triangulation) {
+    if (!stats) return;
+    TraceSpan counting("predicate_stats", "stats");
+    using Exact = VertexPredicates<K>;
+    using Approximate = VertexPredicates<IK>;
+    ToInterval to_interval;
+    auto& orientations = stats->predicates[static_cast<size_t>(PredicateType::Orientation)];
+    auto& spheres = stats->predicates[static_cast<size_t>(PredicateType::InSphere)];
+
+    for (auto cell = triangulation.finite_cells_begin(); cell != triangulation.finite_cells_end(); ++cell) {
+        const auto& p = cell->vertex(0)->point();
+        const auto& q = cell->vertex(1)->point();
+        const auto& r = cell->vertex(2)->point();
+        const auto& s = cell->vertex(3)->point();
+        auto ip = to_interval(p), iq = to_interval(q), ir = to_interval(r), is = to_interval(s);
+        count_predicate(orientations,
+            [&] { return Approximate::orientation(ip, iq, ir, is); },
+            [&] { return Exact::orientation(p, q, r, s); });
+
+        for (int i = 0; i < 4; ++i) {
+            auto neighbor = cell->neighbor(i);
+            // Each facet once, from the cell at the lower address
+            if (triangulation.is_infinite(neighbor) || std::less<>()(&*neighbor, &*cell)) continue;
+            const auto& t = triangulation.mirror_vertex(cell, i)->point();
+            auto it = to_interval(t);
+            count_predicate(spheres,
+                [&] { return Approximate::side_of_sphere(ip, iq, ir, is, it); },
+                [&] { return Exact::side_of_sphere(p, q, r, s, t); });
+        }
+    }
+}
+
+} // namespace
+
 bool InterfaceGenerator::is_multicolored(
     const Tetrahedron& tet,
-    const ColorLabels& color_labels
+    ColorLabelsView color_labels
 ) const {
     std::set<int> colors;
     for (int v : tet) {
@@ -39,46 +169,59 @@ bool InterfaceGenerator::is_multicolored(
     return colors.size() >= 2;
 }
 
-Tetrahedra InterfaceGenerator::get_multicolored_tetrahedra_delaunay(
-    const Points& points,
-    const ColorLabels& color_labels
-) {
+void InterfaceGenerator::get_tetrahedra_delaunay(
+    PointsView points,
+    const ProgressCallback* progress,
+    ComputationStats* stats,
+    bool count_predicates,
+    const CellSink& sink
+) const {
     Delaunay dt;
     std::map<Delaunay::Vertex_handle, int> vertex_to_index;
 
     // Insert points and track indices
+    StageClock triangulating(stats, ComputationStage::Triangulation);
+    ProgressReporter insertion(progress, ComputationStage::Triangulation, points.size());
     for (size_t i = 0; i < points.size(); ++i) {
         const auto& p = points[i];
         auto vh = dt.insert(K::Point_3(p.x(), p.y(), p.z()));
         vertex_to_index[vh] = i;
+        insertion.advance();
     }
-
-    Tetrahedra result;
+    insertion.finish();
+    triangulating.stop();
+    record_triangulation(stats, points.size(), dt, vertex_to_index);
+    if (count_predicates) record_predicates(stats, dt);
 
     // Extract tetrahedra
+    StageClock extracting(stats, ComputationStage::Extraction);
+    ProgressReporter extraction(progress, ComputationStage::Extraction, progress_total_cells(progress, dt));
     for (auto cit = dt.finite_cells_begin(); cit != dt.finite_cells_end(); ++cit) {
         Tetrahedron tet;
         for (int i = 0; i < 4; ++i) {
             tet[i] = vertex_to_index[cit->vertex(i)];
         }
 
-        if (is_multicolored(tet, color_labels)) {
-            result.push_back(tet);
-        }
+        sink(tet);
+        extraction.advance();
     }
-
-    return result;
+    extraction.finish();
 }
 
-Tetrahedra InterfaceGenerator::get_multicolored_tetrahedra_weighted_delaunay(
-    const Points& points,
-    const ColorLabels& color_labels,
-    const Radii& radii
-) {
+void InterfaceGenerator::get_tetrahedra_weighted_delaunay(
+    PointsView points,
+    RadiiView radii,
+    const ProgressCallback* progress,
+    ComputationStats* stats,
+    bool count_predicates,
+    const CellSink& sink
+) const {
     Regular rt;
     std::map<Regular::Vertex_handle, int> vertex_to_index;
 
     // Insert weighted points
+    StageClock triangulating(stats, ComputationStage::Triangulation);
+    ProgressReporter insertion(progress, ComputationStage::Triangulation, points.size());
     for (size_t i = 0; i < points.size(); ++i) {
         const auto& p = points[i];
         double weight = radii[i] * radii[i]; // Weight is radius squared
@@ -89,12 +232,18 @@ Tetrahedra InterfaceGenerator::get_multicolored_tetrahedra_weighted_delaunay(
         if (vh != Regular::Vertex_handle()) {
             vertex_to_index[vh] = i;
         }
+        insertion.advance();
     }
-
-    Tetrahedra result;
+    insertion.finish();
+    triangulating.stop();
+    record_triangulation(stats, points.size(), rt, vertex_to_index);
+    if (count_predicates) record_predicates(stats, rt);
 
     // Extract tetrahedra
+    StageClock extracting(stats, ComputationStage::Extraction);
+    ProgressReporter extraction(progress, ComputationStage::Extraction, progress_total_cells(progress, rt));
     for (auto cit = rt.finite_cells_begin(); cit != rt.finite_cells_end(); ++cit) {
+        extraction.advance();
         if (rt.is_infinite(cit)) continue;
 
         Tetrahedron tet;
@@ -108,24 +257,28 @@ Tetrahedra InterfaceGenerator::get_multicolored_tetrahedra_weighted_delaunay(
             tet[i] = vertex_to_index[vh];
         }
 
-        if (valid && is_multicolored(tet, color_labels)) {
-            result.push_back(tet);
+        if (valid) {
+            sink(tet);
         }
     }
-
-    return result;
+    extraction.finish();
 }
 
-Tetrahedra InterfaceGenerator::get_multicolored_tetrahedra_weighted_alpha(
-    const Points& points,
-    const ColorLabels& color_labels,
-    const Radii& radii
-) {
+void InterfaceGenerator::get_tetrahedra_weighted_alpha(
+    PointsView points,
+    RadiiView radii,
+    const ProgressCallback* progress,
+    ComputationStats* stats,
+    bool count_predicates,
+    const CellSink& sink
+) const {
     // For alpha shapes, we use regular triangulation and filter by alpha value
     Regular rt;
     std::map<Regular::Vertex_handle, int> vertex_to_index;
 
     // Insert weighted points
+    StageClock triangulating(stats, ComputationStage::Triangulation);
+    ProgressReporter insertion(progress, ComputationStage::Triangulation, points.size());
     for (size_t i = 0; i < points.size(); ++i) {
         const auto& p = points[i];
         double weight = radii[i] * radii[i];
@@ -136,14 +289,20 @@ Tetrahedra InterfaceGenerator::get_multicolored_tetrahedra_weighted_alpha(
         if (vh != Regular::Vertex_handle()) {
             vertex_to_index[vh] = i;
         }
+        insertion.advance();
     }
-
-    Tetrahedra result;
+    insertion.finish();
+    triangulating.stop();
+    record_triangulation(stats, points.size(), rt, vertex_to_index);
+    if (count_predicates) record_predicates(stats, rt);
 
     // For weighted alpha complex, we need to check the critical value
     // A simplex is in the alpha complex if its circumsphere radius^2 <= alpha
     // For weighted case, this is the orthogonal sphere
+    StageClock extracting(stats, ComputationStage::Extraction);
+    ProgressReporter extraction(progress, ComputationStage::Extraction, progress_total_cells(progress, rt));
     for (auto cit = rt.finite_cells_begin(); cit != rt.finite_cells_end(); ++cit) {
+        extraction.advance();
         if (rt.is_infinite(cit)) continue;
 
         Tetrahedron tet;
@@ -157,50 +316,474 @@ Tetrahedra InterfaceGenerator::get_multicolored_tetrahedra_weighted_alpha(
             tet[i] = vertex_to_index[vh];
         }
 
-        if (valid && is_multicolored(tet, color_labels)) {
+        if (valid) {
             // Check if in alpha complex (critical value <= 0)
             // The critical value for weighted alpha shapes
             auto critical_value = rt.dual(cit);
             // In CGAL's weighted alpha shapes, cells with critical value <= 0 are in the complex
             // This matches the 'fs <= 0' condition in the Julia code
 
-            result.push_back(tet);
+            sink(tet);
         }
     }
+    extraction.finish();
+}
+
+Tetrahedra InterfaceGenerator::get_tetrahedra(
+    PointsView points,
+    RadiiView radii,
+    bool weighted,
+    bool alpha
+) const {
+    return get_tetrahedra(points, radii, weighted, alpha, std::atomic_load(&progress_).get(), nullptr, false);
+}
 
+Tetrahedra InterfaceGenerator::get_tetrahedra(
+    PointsView points,
+    RadiiView radii,
+    bool weighted,
+    bool alpha,
+    const ProgressCallback* progress,
+    ComputationStats* stats,
+    bool count_predicates
+) const {
+    Tetrahedra result;
+    extract_tetrahedra(points, radii, weighted, alpha, progress, stats, count_predicates,
+        [&](const Tetrahedron& tet) { result.push_back(tet); });
     return result;
 }
 
-Tetrahedra InterfaceGenerator::get_multicolored_tetrahedra(
-    const Points& points,
-    const ColorLabels& color_labels,
-    const Radii& radii,
+void InterfaceGenerator::extract_tetrahedra(
+    PointsView points,
+    RadiiView radii,
     bool weighted,
-    bool alpha
-) {
+    bool alpha,
+    const ProgressCallback* progress,
+    ComputationStats* stats,
+    bool count_predicates,
+    const CellSink& sink
+) const {
     if (weighted) {
         if (alpha) {
-            return get_multicolored_tetrahedra_weighted_alpha(points, color_labels, radii);
+            get_tetrahedra_weighted_alpha(points, radii, progress, stats, count_predicates, sink);
         } else {
-            return get_multicolored_tetrahedra_weighted_delaunay(points, color_labels, radii);
+            get_tetrahedra_weighted_delaunay(points, radii, progress, stats, count_predicates, sink);
         }
     } else {
-        return get_multicolored_tetrahedra_delaunay(points, color_labels);
+        get_tetrahedra_delaunay(points, progress, stats, count_predicates, sink);
+    }
+}
+
+Tetrahedra InterfaceGenerator::filter_multicolored(
+    Tetrahedra tetrahedra,
+    ColorLabelsView color_labels,
+    Executor* executor
+) const {
+    if (!executor || executor->concurrency() < 2) {
+        tetrahedra.erase(
+            std::remove_if(tetrahedra.begin(), tetrahedra.end(),
+                [&](const Tetrahedron& tet) { return !is_multicolored(tet, color_labels); }),
+            tetrahedra.end()
+        );
+        return tetrahedra;
+    }
+
+    // Label lookups in parallel, then an in-order compaction
+    std::vector<char> keep(tetrahedra.size());
+    executor->parallel_for(tetrahedra.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            keep[i] = is_multicolored(tetrahedra[i], color_labels);
+        }
+    });
+
+    size_t kept = 0;
+    for (size_t i = 0; i < tetrahedra.size(); ++i) {
+        if (keep[i]) tetrahedra[kept++] = tetrahedra[i];
+    }
+    tetrahedra.resize(kept);
+    return tetrahedra;
+}
+
+namespace {
+
+constexpr size_t kPipelineBlockSize = 1024;  // Cells per queued block
+constexpr size_t kPipelineCapacity = 64;     // Blocks in flight
+
+enum PipelineConsumer { Unclaimed, ConsumerTask, Caller };
+
+// Shared with the consumer task, which may start after the computation ended
+struct SubdivisionPipeline {
+    SpscQueue<Tetrahedra> blocks{kPipelineCapacity};
+    std::atomic<int> consumer{Unclaimed};
+    std::atomic<bool> failed{false};
+    std::atomic<bool> finished{false};
+    std::exception_ptr error;
+
+    bool claim(PipelineConsumer by) {
+        int expected = Unclaimed;
+        return consumer.compare_exchange_strong(expected, by, std::memory_order_acq_rel);
+    }
+};
+
+InterfaceSurface make_surface(
+    const BarycentricSubdivision& subdivision,
+    bool weighted,
+    bool alpha,
+    const ProgressCallback* progress,
+    ComputationStats* stats,   // Null while stats are off
+    bool estimate_memory,      // Fill stats->memory
+    size_t overlapping_bytes,  // Other structures alive through subdivision and sorting
+    Executor* executor
+) {
+    StageClock sorting_clock(stats, ComputationStage::Sorting);
+    ProgressReporter sorting(progress, ComputationStage::Sorting, 1);
+    InterfaceSurface surface{
+        subdivision.get_barycenters(),
+        subdivision.get_filtration(executor),
+        weighted,
+        alpha,
+        subdivision.get_generators(),
+        std::nullopt
+    };
+    sorting.finish();
+    sorting_clock.stop();
+    if (!stats) return surface;
+
+    const auto& counters = subdivision.get_counters();
+    stats->cells_by_partition = counters.cells_by_partition;
+    stats->simplex_hits = counters.simplex_hits;
+    stats->simplex_misses = counters.simplex_misses;
+    for (const auto& [simplex, value] : surface.filtration) {
+        if (!simplex.empty() && simplex.size() <= stats->simplices_by_dimension.size()) {
+            ++stats->simplices_by_dimension[simplex.size() - 1];
+        }
+    }
+
+    if (!estimate_memory) {
+        // Drop the estimates taken along the way, so they are all set or all zero
+        stats->memory = MemoryStats{};
+        surface.stats = std::move(*stats);
+        return surface;
+    }
+
+    // Walks every simplex of the table, the filtration set and the output
+    size_t sorted_bytes = vector_bytes(surface.filtration);
+    for (const auto& entry : surface.filtration) {
+        sorted_bytes += heap_block_bytes(std::get<0>(entry).capacity() * sizeof(int32_t));
     }
+    auto usage = subdivision.memory_usage();
+    auto& memory = stats->memory;
+    memory.simplex_table_bytes = usage.simplex_table;
+    memory.filtration_bytes = usage.filtration + sorted_bytes;
+    memory.barycenter_bytes = usage.barycenters;
+    memory.peak_bytes = std::max(memory.peak_bytes,
+        overlapping_bytes + usage.simplex_table + memory.filtration_bytes + usage.barycenters);
+    memory.peak_rss_bytes = peak_resident_bytes();
+
+    surface.stats = std::move(*stats);
+    return surface;
+}
+
+} // namespace
+
+void InterfaceGenerator::subdivide_pipelined(
+    PointsView points,
+    ColorLabelsView color_labels,
+    RadiiView radii,
+    bool weighted,
+    bool alpha,
+    const ProgressCallback* progress,
+    ComputationStats* stats,
+    bool count_predicates,
+    Executor& executor,
+    BarycentricSubdivision& subdivision
+) const {
+    auto pipeline = std::make_shared<SubdivisionPipeline>();
+    if (stats) {
+        // Queued blocks plus the one being filled and the one being subdivided
+        stats->memory.cells_bytes =
+            (kPipelineCapacity + 2) * heap_block_bytes(kPipelineBlockSize * sizeof(Tetrahedron));
+    }
+
+    // Whoever claims the pipeline first subdivides: normally the consumer task.
+    // If it has not started when the caller would have to wait for it (e.g.
+    // all workers are busy), the caller claims it and subdivides itself, so
+    // the pipeline never depends on a free thread. The task is submitted with
+    // the first block, so no worker waits on the queue through triangulation.
+    TraceRecorder* trace = current_trace_recorder();
+    bool consumer_submitted = false;
+    auto submit_consumer = [&] {
+        consumer_submitted = true;
+        executor.submit([pipeline, progress, trace, stats, &subdivision] {
+            if (!pipeline->claim(ConsumerTask)) return;
+            TraceScope tracing(trace);
+            try {
+                // Started with the first block, so the stage excludes triangulation
+                std::optional<StageClock> clock;
+                std::optional<ProgressReporter> subdividing;
+                size_t processed = 0;
+                while (auto block = pipeline->blocks.pop()) {
+                    if (!subdividing) {
+                        clock.emplace(stats, ComputationStage::Subdivision);
+                        subdividing.emplace(progress, ComputationStage::Subdivision, 0);
+                    }
+                    TraceSpan span("block", "pipeline", static_cast<int64_t>(processed / kPipelineBlockSize));
+                    for (const auto& tet : *block) {
+                        subdivision.process_tetrahedron(tet);
+                    }
+                    processed += block->size();
+                    subdividing->advance(block->size());
+                }
+                if (subdividing) {
+                    subdividing->set_total(processed);
+                    subdividing->finish();
+                }
+            } catch (...) {
+                pipeline->error = std::current_exception();
+                pipeline->failed.store(true, std::memory_order_release);
+                // Let the producer run on to its next check
+                while (pipeline->blocks.pop()) {}
+            }
+            pipeline->finished.store(true, std::memory_order_release);
+        });
+    };
+
+    std::optional<ProgressReporter> subdividing;  // Set once the caller subdivides
+    std::optional<StageClock> subdivision_clock;
+    size_t processed = 0;
+    auto subdivide = [&](const Tetrahedra& block) {
+        TraceSpan span("block", "pipeline", static_cast<int64_t>(processed / kPipelineBlockSize));
+        for (const auto& tet : block) {
+            subdivision.process_tetrahedron(tet);
+        }
+        processed += block.size();
+        subdividing->advance(block.size());
+    };
+    auto take_over = [&] {
+        if (!pipeline->claim(Caller)) return false;
+        subdivision_clock.emplace(stats, ComputationStage::Subdivision);
+        subdividing.emplace(progress, ComputationStage::Subdivision, 0);
+        while (auto queued = pipeline->blocks.try_pop()) {
+            subdivide(*queued);
+        }
+        return true;
+    };
+    auto wait_for_consumer = [&] {
+        if (take_over()) return;
+        Backoff backoff;
+        while (pipeline->consumer.load(std::memory_order_acquire) == ConsumerTask &&
+               !pipeline->finished.load(std::memory_order_acquire)) {
+            backoff.wait();
+        }
+    };
+
+    Tetrahedra block;
+    block.reserve(kPipelineBlockSize);
+    auto flush = [&] {
+        if (pipeline->failed.load(std::memory_order_acquire)) {
+            std::rethrow_exception(pipeline->error);
+        }
+        if (!consumer_submitted) submit_consumer();
+        Backoff backoff;
+        while (!subdividing && !pipeline->blocks.try_push(block)) {
+            if (take_over()) break;
+            backoff.wait();
+        }
+        if (subdividing) {
+            subdivide(block);
+        }
+        block.clear();
+    };
+
+    try {
+        extract_tetrahedra(points, radii, weighted, alpha, progress, stats, count_predicates,
+            [&](const Tetrahedron& tet) {
+                if (stats) ++stats->finite_cells;
+                if (!is_multicolored(tet, color_labels)) return;
+                if (stats) ++stats->multicolored_cells;
+                block.push_back(tet);
+                if (block.size() == kPipelineBlockSize) {
+                    flush();
+                }
+            });
+        if (!block.empty()) {
+            flush();
+        }
+    } catch (...) {
+        pipeline->blocks.close();
+        wait_for_consumer();
+        throw;
+    }
+
+    pipeline->blocks.close();
+    wait_for_consumer();
+
+    if (pipeline->failed.load(std::memory_order_acquire)) {
+        std::rethrow_exception(pipeline->error);
+    }
+    if (subdividing) {
+        subdividing->set_total(processed);
+        subdividing->finish();
+    }
+}
+
+Tetrahedra InterfaceGenerator::get_multicolored_tetrahedra(
+    PointsView points,
+    ColorLabelsView color_labels,
+    RadiiView radii,
+    bool weighted,
+    bool alpha
+) const {
+    return filter_multicolored(get_tetrahedra(points, radii, weighted, alpha), color_labels,
+                               std::atomic_load(&executor_).get());
+}
+
+void InterfaceGenerator::set_checkpoint_options(const CheckpointOptions& options) {
+    std::atomic_store(&checkpoint_, std::make_shared<const CheckpointOptions>(options));
+}
+
+CheckpointOptions InterfaceGenerator::get_checkpoint_options() const {
+    return *std::atomic_load(&checkpoint_);
+}
+
+void InterfaceGenerator::set_progress_callback(ProgressCallback callback) {
+    std::atomic_store(&progress_, std::make_shared<const ProgressCallback>(std::move(callback)));
+}
+
+void InterfaceGenerator::set_trace_recorder(std::shared_ptr<TraceRecorder> recorder) {
+    std::atomic_store(&trace_, std::move(recorder));
+}
+
+std::shared_ptr<TraceRecorder> InterfaceGenerator::get_trace_recorder() const {
+    return std::atomic_load(&trace_);
+}
+
+void InterfaceGenerator::set_stats_options(const StatsOptions& options) {
+    std::atomic_store(&stats_options_, std::make_shared<const StatsOptions>(options));
+}
+
+StatsOptions InterfaceGenerator::get_stats_options() const {
+    return *std::atomic_load(&stats_options_);
+}
+
+void InterfaceGenerator::set_executor(std::shared_ptr<Executor> executor) {
+    std::atomic_store(&executor_, std::move(executor));
+}
+
+std::shared_ptr<Executor> InterfaceGenerator::get_executor() const {
+    return std::atomic_load(&executor_);
 }
 
 InterfaceSurface InterfaceGenerator::compute_interface_surface(
-    const Points& points,
-    const ColorLabels& color_labels,
-    const Radii& radii,
+    PointsView points,
+    ColorLabelsView color_labels,
+    RadiiView radii,
     bool weighted,
     bool alpha
-) {
-    auto [vertices, filtration] = get_barycentric_subdivision_and_filtration(
-        points, color_labels, radii, weighted, alpha
-    );
+) const {
+    if (points.size() != color_labels.size()) {
+        throw std::invalid_argument("Each point must have a corresponding color_label");
+    }
+
+    if (weighted && radii.size() != points.size()) {
+        throw std::invalid_argument("Each point must have an assigned radius for weighted complexes");
+    }
+
+    const auto checkpoint_options = std::atomic_load(&checkpoint_);
+    const CheckpointOptions& checkpoint = *checkpoint_options;
+    const auto progress_callback = std::atomic_load(&progress_);
+    const ProgressCallback* progress = progress_callback.get();
+    const auto executor = std::atomic_load(&executor_);
+    // Without a recorder of its own, a computation traces into the caller's
+    const auto trace = std::atomic_load(&trace_);
+    TraceScope tracing(trace ? trace.get() : current_trace_recorder());
+    TraceSpan computing("compute_interface_surface", "computation");
+    const auto stats_options = std::atomic_load(&stats_options_);
+    ComputationStats stats;
+    // Null while stats are off, so the stages keep no times or counts
+    ComputationStats* recording = stats_options->enabled ? &stats : nullptr;
+    const bool checkpointing = !checkpoint.path.empty();
+    const std::string triangulation_path = checkpoint.path + ".tri";
+    const std::string subdivision_path = checkpoint.path + ".sub";
+
+    // Checkpoints index the complete list of cells, so only runs without them
+    // overlap extraction and subdivision
+    if (executor && executor->concurrency() > 1 && !checkpointing) {
+        BarycentricSubdivision subdivision(points, color_labels);
+        subdivide_pipelined(points, color_labels, radii, weighted, alpha, progress, recording,
+                            recording && stats_options->predicates, *executor, subdivision);
+        // The triangulation lives on while its cells are subdivided
+        size_t overlapping = stats.memory.triangulation_bytes + stats.memory.cells_bytes;
+        return make_surface(subdivision, weighted, alpha, progress, recording, stats_options->memory, overlapping,
+                            executor.get());
+    }
+
+    // Triangulation, possibly restored from a checkpoint
+    TriangulationCells triangulation;
+    uint64_t triangulation_hash = checkpointing ? hash_triangulation_input(points, radii, weighted, alpha) : 0;
+    bool restored = false;
+
+    if (checkpointing && checkpoint.resume && std::filesystem::exists(triangulation_path)) {
+        triangulation = load_triangulation(triangulation_path);
+        restored = triangulation.input_hash == triangulation_hash;
+    }
+
+    if (!restored) {
+        triangulation.input_hash = triangulation_hash;
+        triangulation.cells = get_tetrahedra(points, radii, weighted, alpha, progress, recording,
+                                             recording && stats_options->predicates);
+        if (checkpointing) {
+            save_triangulation(triangulation_path, triangulation);
+        }
+    }
+
+    if (recording) {
+        stats.finite_cells = triangulation.cells.size();
+        stats.memory.cells_bytes = vector_bytes(triangulation.cells);
+        stats.memory.peak_bytes = stats.memory.triangulation_bytes + stats.memory.cells_bytes;
+    }
+    StageClock filtering(recording, ComputationStage::Extraction);
+    auto tetrahedra = filter_multicolored(std::move(triangulation.cells), color_labels, executor.get());
+    filtering.stop();
+    if (recording) stats.multicolored_cells = tetrahedra.size();
+
+    // Subdivision, possibly continuing from a checkpoint
+    BarycentricSubdivision subdivision(points, color_labels);
+    uint64_t subdivision_hash = hash_subdivision_input(triangulation_hash, color_labels);
+    size_t processed = 0;
+
+    if (checkpointing && checkpoint.resume &&
+        load_subdivision_checkpoint(subdivision_path, subdivision_hash, processed, subdivision) &&
+        processed > tetrahedra.size()) {
+        throw std::runtime_error("Checkpoint '" + subdivision_path + "' does not match its triangulation");
+    }
+
+    const size_t interval = std::max<size_t>(1, checkpoint.interval);
+    StageClock subdivision_clock(recording, ComputationStage::Subdivision);
+    // Checkpointed runs report at least at every checkpoint, after saving it,
+    // so a run cancelled from the callback resumes where it was cancelled
+    ProgressReporter subdividing(progress, ComputationStage::Subdivision, tetrahedra.size(),
+                                 checkpointing ? std::min<size_t>(interval, 4096) : 4096);
+    subdividing.advance(processed);
+    for (size_t i = processed; i < tetrahedra.size(); ++i) {
+        subdivision.process_tetrahedron(tetrahedra[i]);
+
+        if (checkpointing && (i + 1) % interval == 0 && i + 1 < tetrahedra.size()) {
+            save_subdivision_checkpoint(subdivision_path, subdivision_hash, i + 1, subdivision);
+        }
+        subdividing.advance();
+    }
+
+    subdividing.finish();
+    subdivision_clock.stop();
+
+    // The triangulation stays available for reuse; the subdivision is complete
+    if (checkpointing) {
+        std::filesystem::remove(subdivision_path);
+    }
 
-    return InterfaceSurface{vertices, filtration, weighted, alpha};
+    return make_surface(subdivision, weighted, alpha, progress, recording, stats_options->memory,
+                        vector_bytes(tetrahedra), executor.get());
 }
 
 } // namespace delaunay_interfaces
@@ -0,0 +1,96 @@
+#include "delaunay_interfaces/memory.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+namespace delaunay_interfaces {
+
+#ifdef DELAUNAY_INTERFACES_TRACK_ALLOCATIONS
+namespace {
+
+std::atomic<size_t> allocation_count{0};
+std::atomic<size_t> allocation_bytes{0};
+
+void* counted_allocation(size_t size, size_t alignment) {
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    allocation_bytes.fetch_add(size, std::memory_order_relaxed);
+    if (size == 0) size = 1;
+
+    void* memory = nullptr;
+    if (alignment <= alignof(std::max_align_t)) {
+        memory = std::malloc(size);
+    } else if (posix_memalign(&memory, alignment, size) != 0) {
+        memory = nullptr;
+    }
+    if (!memory) throw std::bad_alloc();
+    return memory;
+}
+
+} // namespace
+#endif
+
+AllocationCounters allocation_counters() {
+#ifdef DELAUNAY_INTERFACES_TRACK_ALLOCATIONS
+    return AllocationCounters{
+        allocation_count.load(std::memory_order_relaxed),
+        allocation_bytes.load(std::memory_order_relaxed)
+    };
+#else
+    return {};
+#endif
+}
+
+bool allocation_tracking_enabled() {
+#ifdef DELAUNAY_INTERFACES_TRACK_ALLOCATIONS
+    return true;
+#else
+    return false;
+#endif
+}
+
+size_t peak_resident_bytes() {
+#if defined(__unix__) || defined(__APPLE__)
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#ifdef __APPLE__
+    return static_cast<size_t>(usage.ru_maxrss);         // Bytes
+#else
+    return static_cast<size_t>(usage.ru_maxrss) * 1024;  // Kilobytes
+#endif
+#else
+    return 0;
+#endif
+}
+
+} // namespace delaunay_interfaces
+
+#ifdef DELAUNAY_INTERFACES_TRACK_ALLOCATIONS
+// The array and nothrow forms forward to these
+void* operator new(size_t size) {
+    return delaunay_interfaces::counted_allocation(size, 0);
+}
+
+void* operator new(size_t size, std::align_val_t alignment) {
+    return delaunay_interfaces::counted_allocation(size, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::align_val_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, size_t, std::align_val_t) noexcept {
+    std::free(memory);
+}
+#endif
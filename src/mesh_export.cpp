@@ -0,0 +1,231 @@
+#include "delaunay_interfaces/mesh_export.hpp"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+namespace delaunay_interfaces {
+
+namespace {
+
+constexpr size_t kFlushThreshold = 1 << 16;
+
+void check_surface(const InterfaceSurface& surface) {
+    if (surface.generators.size() != surface.vertices.size()) {
+        throw std::invalid_argument(
+            "Surface has no generating points for its vertices; compute it with InterfaceGenerator");
+    }
+}
+
+std::ofstream open_output(const std::string& path, std::ios::openmode mode) {
+    std::ofstream out(path, mode);
+    if (!out) {
+        throw std::runtime_error("Cannot open '" + path + "' for writing");
+    }
+    return out;
+}
+
+// Filtration value of each vertex, indexed by vertex position (simplex id - 1)
+std::vector<double> get_vertex_values(const InterfaceSurface& surface) {
+    std::vector<double> values(surface.vertices.size(), 0.0);
+    for (const auto& [simplex, value] : surface.filtration) {
+        if (simplex.size() == 1) {
+            values[simplex[0] - 1] = value;
+        }
+    }
+    return values;
+}
+
+size_t count_triangles(const Filtration& filtration) {
+    return std::count_if(filtration.begin(), filtration.end(),
+        [](const auto& s) { return std::get<0>(s).size() == 3; });
+}
+
+// Every interface triangle contains a vertex generated by exactly two colors;
+// those are the colors the triangle separates.
+std::pair<int, int> get_color_pair(
+    const Simplex& triangle,
+    const InterfaceSurface& surface,
+    const ColorLabels& color_labels
+) {
+    std::pair<int, int> best{0, 0};
+    size_t best_count = 5;
+
+    for (int32_t id : triangle) {
+        int colors[4];
+        size_t count = 0;
+        for (int idx : surface.generators[id - 1]) {
+            if (idx < 0) break;
+            int color = color_labels[idx];
+            if (std::find(colors, colors + count, color) == colors + count) {
+                colors[count++] = color;
+            }
+        }
+        if (count < best_count) {
+            std::sort(colors, colors + count);
+            best = {colors[0], count > 1 ? colors[1] : colors[0]};
+            best_count = count;
+        }
+    }
+
+    return best;
+}
+
+bool host_is_little_endian() {
+    const uint16_t one = 1;
+    unsigned char first;
+    std::memcpy(&first, &one, 1);
+    return first == 1;
+}
+
+template<typename T>
+void append_binary(std::string& buffer, const T& value) {
+    buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+void append_text(std::string& buffer, T value) {
+    char chars[32];
+    auto result = std::to_chars(chars, chars + sizeof(chars), value);
+    buffer.append(chars, result.ptr);
+}
+
+void flush_if_full(std::ofstream& out, std::string& buffer) {
+    if (buffer.size() >= kFlushThreshold) {
+        out.write(buffer.data(), buffer.size());
+        buffer.clear();
+    }
+}
+
+void finish(std::ofstream& out, std::string& buffer, const std::string& path) {
+    out.write(buffer.data(), buffer.size());
+    out.flush();
+    if (!out) {
+        throw std::runtime_error("Failed writing '" + path + "'");
+    }
+}
+
+} // namespace
+
+void write_ply(
+    const std::string& path,
+    const InterfaceSurface& surface,
+    const ColorLabels& color_labels
+) {
+    check_surface(surface);
+
+    auto out = open_output(path, std::ios::out | std::ios::binary);
+    auto vertex_values = get_vertex_values(surface);
+
+    std::string buffer;
+    buffer.reserve(kFlushThreshold + 256);
+    buffer += "ply\n";
+    buffer += host_is_little_endian() ? "format binary_little_endian 1.0\n"
+                                      : "format binary_big_endian 1.0\n";
+    buffer += "comment DelaunayInterfaces interface surface\n";
+    buffer += "element vertex " + std::to_string(surface.vertices.size()) + "\n";
+    buffer += "property double x\n";
+    buffer += "property double y\n";
+    buffer += "property double z\n";
+    buffer += "property double filtration\n";
+    buffer += "element face " + std::to_string(count_triangles(surface.filtration)) + "\n";
+    buffer += "property list uchar int vertex_indices\n";
+    buffer += "property double filtration\n";
+    buffer += "property int color_a\n";
+    buffer += "property int color_b\n";
+    buffer += "end_header\n";
+
+    for (size_t i = 0; i < surface.vertices.size(); ++i) {
+        const auto& v = surface.vertices[i];
+        append_binary(buffer, v.x());
+        append_binary(buffer, v.y());
+        append_binary(buffer, v.z());
+        append_binary(buffer, vertex_values[i]);
+        flush_if_full(out, buffer);
+    }
+
+    for (const auto& [simplex, value] : surface.filtration) {
+        if (simplex.size() != 3) continue;
+
+        auto [color_a, color_b] = get_color_pair(simplex, surface, color_labels);
+        append_binary(buffer, static_cast<uint8_t>(3));
+        for (int32_t id : simplex) {
+            append_binary(buffer, static_cast<int32_t>(id - 1));
+        }
+        append_binary(buffer, value);
+        append_binary(buffer, static_cast<int32_t>(color_a));
+        append_binary(buffer, static_cast<int32_t>(color_b));
+        flush_if_full(out, buffer);
+    }
+
+    finish(out, buffer, path);
+}
+
+void write_obj(
+    const std::string& path,
+    const InterfaceSurface& surface,
+    const ColorLabels& color_labels
+) {
+    check_surface(surface);
+
+    auto out = open_output(path, std::ios::out);
+    auto vertex_values = get_vertex_values(surface);
+
+    std::string buffer;
+    buffer.reserve(kFlushThreshold + 256);
+    buffer += "# DelaunayInterfaces interface surface\n";
+    buffer += "# vt u coordinate: vertex filtration value\n";
+
+    for (const auto& v : surface.vertices) {
+        buffer += "v ";
+        append_text(buffer, v.x());
+        buffer += ' ';
+        append_text(buffer, v.y());
+        buffer += ' ';
+        append_text(buffer, v.z());
+        buffer += '\n';
+        flush_if_full(out, buffer);
+    }
+
+    for (double value : vertex_values) {
+        buffer += "vt ";
+        append_text(buffer, value);
+        buffer += " 0\n";
+        flush_if_full(out, buffer);
+    }
+
+    std::pair<int, int> group{0, 0};
+    bool has_group = false;
+
+    for (const auto& [simplex, value] : surface.filtration) {
+        if (simplex.size() != 3) continue;
+
+        auto pair = get_color_pair(simplex, surface, color_labels);
+        if (!has_group || pair != group) {
+            buffer += "g interface_";
+            append_text(buffer, pair.first);
+            buffer += '_';
+            append_text(buffer, pair.second);
+            buffer += '\n';
+            group = pair;
+            has_group = true;
+        }
+
+        // OBJ indices are 1-based, like the simplex ids
+        buffer += 'f';
+        for (int32_t id : simplex) {
+            buffer += ' ';
+            append_text(buffer, id);
+            buffer += '/';
+            append_text(buffer, id);
+        }
+        buffer += '\n';
+        flush_if_full(out, buffer);
+    }
+
+    finish(out, buffer, path);
+}
+
+} // namespace delaunay_interfaces
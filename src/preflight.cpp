@@ -0,0 +1,201 @@
+#include "delaunay_interfaces/preflight.hpp"
+#include "delaunay_interfaces/interface_generation.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <queue>
+#include <random>
+#include <stdexcept>
+#include <utility>
+
+namespace delaunay_interfaces {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t kMinWindowSize = 64;
+// Shorter samples are too noisy to fit a growth exponent to
+constexpr double kMinFitSeconds = 1e-3;
+constexpr double kMaxTimeExponent = 1.5;
+
+// Indices of the `count` points nearest to `center`, nearest first. A bounded
+// heap keeps the memory at O(count) for inputs of any size.
+std::vector<size_t> nearest_points(PointsView points, const Point3D& center, size_t count) {
+    std::priority_queue<std::pair<double, size_t>> farthest;
+    for (size_t i = 0; i < points.size(); ++i) {
+        double distance = (points[i] - center).squaredNorm();
+        if (farthest.size() < count) {
+            farthest.emplace(distance, i);
+        } else if (distance < farthest.top().first) {
+            farthest.pop();
+            farthest.emplace(distance, i);
+        }
+    }
+
+    std::vector<size_t> indices(farthest.size());
+    for (size_t i = indices.size(); i-- > 0; farthest.pop()) {
+        indices[i] = farthest.top().second;
+    }
+    return indices;
+}
+
+struct Window {
+    Points points;
+    ColorLabels color_labels;
+    Radii radii;
+};
+
+// The first `count` of `indices`
+Window gather(
+    PointsView points,
+    ColorLabelsView color_labels,
+    RadiiView radii,
+    const std::vector<size_t>& indices,
+    size_t count
+) {
+    Window window;
+    window.points.reserve(count);
+    window.color_labels.reserve(count);
+    for (size_t k = 0; k < count; ++k) {
+        size_t i = indices[k];
+        window.points.push_back(points[i]);
+        window.color_labels.push_back(color_labels[i]);
+        if (!radii.empty()) window.radii.push_back(radii[i]);
+    }
+    return window;
+}
+
+void accumulate(ComputationStats& total, const ComputationStats& stats) {
+    total.finite_cells += stats.finite_cells;
+    total.multicolored_cells += stats.multicolored_cells;
+    for (size_t i = 0; i < total.cells_by_partition.size(); ++i) {
+        total.cells_by_partition[i] += stats.cells_by_partition[i];
+    }
+    for (size_t i = 0; i < total.simplices_by_dimension.size(); ++i) {
+        total.simplices_by_dimension[i] += stats.simplices_by_dimension[i];
+    }
+    total.memory.triangulation_bytes += stats.memory.triangulation_bytes;
+    total.memory.cells_bytes += stats.memory.cells_bytes;
+    total.memory.simplex_table_bytes += stats.memory.simplex_table_bytes;
+    total.memory.filtration_bytes += stats.memory.filtration_bytes;
+    total.memory.barycenter_bytes += stats.memory.barycenter_bytes;
+    total.memory.peak_bytes += stats.memory.peak_bytes;
+}
+
+// Scales the totals of `windows` sample runs by `scale`. The pipeline's queue
+// has a fixed size, so its cells are averaged instead.
+void extrapolate(
+    PreflightEstimate& estimate,
+    const ComputationStats& sample,
+    size_t windows,
+    double scale,
+    bool pipelined
+) {
+    auto scaled = [scale](size_t count) { return static_cast<size_t>(std::llround(count * scale)); };
+
+    estimate.finite_cells = scaled(sample.finite_cells);
+    estimate.multicolored_cells = scaled(sample.multicolored_cells);
+    for (size_t i = 0; i < sample.cells_by_partition.size(); ++i) {
+        estimate.cells_by_partition[i] = scaled(sample.cells_by_partition[i]);
+    }
+    for (size_t i = 0; i < sample.simplices_by_dimension.size(); ++i) {
+        estimate.simplices_by_dimension[i] = scaled(sample.simplices_by_dimension[i]);
+    }
+
+    auto& memory = estimate.memory;
+    size_t queued_bytes = pipelined ? sample.memory.cells_bytes : 0;
+    memory.triangulation_bytes = scaled(sample.memory.triangulation_bytes);
+    memory.cells_bytes = pipelined ? queued_bytes / windows : scaled(sample.memory.cells_bytes);
+    memory.simplex_table_bytes = scaled(sample.memory.simplex_table_bytes);
+    memory.filtration_bytes = scaled(sample.memory.filtration_bytes);
+    memory.barycenter_bytes = scaled(sample.memory.barycenter_bytes);
+    memory.peak_bytes = scaled(sample.memory.peak_bytes - queued_bytes) + queued_bytes / windows;
+}
+
+} // namespace
+
+PreflightEstimate estimate_interface_surface(
+    PointsView points,
+    ColorLabelsView color_labels,
+    RadiiView radii,
+    bool weighted,
+    bool alpha,
+    const PreflightOptions& options
+) {
+    if (points.size() != color_labels.size()) {
+        throw std::invalid_argument("Each point must have a corresponding color_label");
+    }
+    if (weighted && radii.size() != points.size()) {
+        throw std::invalid_argument("Each point must have an assigned radius for weighted complexes");
+    }
+    if (options.sample_size == 0 || options.windows == 0) {
+        throw std::invalid_argument("sample_size and windows must be positive");
+    }
+
+    const auto begin = Clock::now();
+    // A generator of its own, so the sample writes no checkpoints and reports no progress
+    InterfaceGenerator generator;
+    generator.set_executor(options.executor);
+    StatsOptions stats_options;
+    stats_options.enabled = true;
+    stats_options.memory = true;
+    generator.set_stats_options(stats_options);
+    const bool pipelined = options.executor && options.executor->concurrency() > 1;
+
+    auto compute = [&](PointsView sample_points, ColorLabelsView sample_labels, RadiiView sample_radii,
+                       double& seconds) {
+        auto start = Clock::now();
+        auto surface = generator.compute_interface_surface(sample_points, sample_labels, sample_radii, weighted, alpha);
+        seconds += std::chrono::duration<double>(Clock::now() - start).count();
+        return *surface.stats;
+    };
+
+    PreflightEstimate estimate;
+    estimate.points = points.size();
+
+    if (points.size() <= options.sample_size) {
+        ComputationStats stats = compute(points, color_labels, radii, estimate.seconds);
+        extrapolate(estimate, stats, 1, 1.0, pipelined);
+        estimate.sampled_points = points.size();
+        estimate.exact = true;
+        estimate.sample_seconds = std::chrono::duration<double>(Clock::now() - begin).count();
+        return estimate;
+    }
+
+    const size_t window_size = std::min(points.size(), std::max(options.sample_size / options.windows, kMinWindowSize));
+    const size_t quarter_size = window_size / 4;
+    std::mt19937_64 random(options.seed);
+    std::uniform_int_distribution<size_t> pick(0, points.size() - 1);
+
+    ComputationStats total;
+    double window_seconds = 0;
+    double quarter_seconds = 0;
+    for (size_t w = 0; w < options.windows; ++w) {
+        auto indices = nearest_points(points, points[pick(random)], window_size);
+        Window window = gather(points, color_labels, radii, indices, indices.size());
+        accumulate(total, compute(window.points, window.color_labels, window.radii, window_seconds));
+        estimate.sampled_points += indices.size();
+
+        // Nearest first, so this is the core of the same neighbourhood
+        Window quarter = gather(points, color_labels, radii, indices, quarter_size);
+        compute(quarter.points, quarter.color_labels, quarter.radii, quarter_seconds);
+    }
+
+    extrapolate(estimate, total, options.windows,
+                static_cast<double>(points.size()) / estimate.sampled_points, pipelined);
+
+    // Superlinear growth comes from point location and cache misses; below a
+    // linear fit the sample is too small to tell, so linear is assumed
+    if (quarter_seconds >= kMinFitSeconds && window_seconds > quarter_seconds) {
+        double exponent = std::log(window_seconds / quarter_seconds) /
+                          std::log(static_cast<double>(window_size) / quarter_size);
+        estimate.time_exponent = std::clamp(exponent, 1.0, kMaxTimeExponent);
+    }
+    estimate.seconds = window_seconds / options.windows *
+                       std::pow(static_cast<double>(points.size()) / window_size, estimate.time_exponent);
+    estimate.sample_seconds = std::chrono::duration<double>(Clock::now() - begin).count();
+    return estimate;
+}
+
+} // namespace delaunay_interfaces
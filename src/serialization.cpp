@@ -0,0 +1,436 @@
+#include "delaunay_interfaces/serialization.hpp"
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+namespace delaunay_interfaces {
+
+namespace {
+
+constexpr char kSurfaceMagic[9] = "DISURF01";
+
+constexpr uint8_t kWeighted = 1;
+constexpr uint8_t kAlpha = 2;
+
+uint64_t zigzag(int64_t value) {
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+int64_t unzigzag(uint64_t value) {
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+uint64_t double_bits(double value) {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+double bits_double(uint64_t bits) {
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+class ByteWriter {
+public:
+    explicit ByteWriter(std::string& out) : out_(out) {}
+
+    template<typename T>
+    void put(const T& value) {
+        out_.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template<typename T>
+    void put_array(const T* data, size_t count) {
+        out_.append(reinterpret_cast<const char*>(data), sizeof(T) * count);
+    }
+
+    // Value count, byte length and LEB128 varints
+    void put_varints(const std::vector<uint64_t>& values) {
+        std::string bytes;
+        bytes.reserve(values.size() * 2);
+        for (uint64_t value : values) {
+            while (value >= 0x80) {
+                bytes += static_cast<char>((value & 0x7f) | 0x80);
+                value >>= 7;
+            }
+            bytes += static_cast<char>(value);
+        }
+        put<uint64_t>(values.size());
+        put<uint64_t>(bytes.size());
+        out_ += bytes;
+    }
+
+private:
+    std::string& out_;
+};
+
+class ByteReader {
+public:
+    explicit ByteReader(std::string_view data)
+        : pos_(reinterpret_cast<const uint8_t*>(data.data())), end_(pos_ + data.size()) {}
+
+    template<typename T>
+    T get() {
+        T value;
+        get_array(&value, 1);
+        return value;
+    }
+
+    template<typename T>
+    void get_array(T* data, size_t count) {
+        require(sizeof(T) * count);
+        std::memcpy(data, pos_, sizeof(T) * count);
+        pos_ += sizeof(T) * count;
+    }
+
+    // A count of elements taking at least `element_bytes` each, checked
+    // against the remaining data before it sizes an allocation
+    uint64_t get_count(size_t element_bytes) {
+        uint64_t count = get<uint64_t>();
+        if (count > remaining() / element_bytes) {
+            throw std::runtime_error("Corrupt element count in serialized surface");
+        }
+        return count;
+    }
+
+    std::vector<uint64_t> get_varints() {
+        uint64_t count = get<uint64_t>();
+        uint64_t length = get<uint64_t>();
+        require(length);
+        // Every varint takes at least one byte
+        if (count > length) {
+            throw std::runtime_error("Corrupt varint data in serialized surface");
+        }
+
+        std::vector<uint64_t> values(count);
+        const uint8_t* p = pos_;
+        const uint8_t* end = pos_ + length;
+        size_t i = 0;
+
+        while (i < count) {
+            // Fast path: eight single-byte varints at once
+            uint64_t word;
+            if (end - p >= 8 && count - i >= 8) {
+                std::memcpy(&word, p, 8);
+                if ((word & 0x8080808080808080ull) == 0) {
+                    for (int k = 0; k < 8; ++k) {
+                        values[i + k] = p[k];
+                    }
+                    i += 8;
+                    p += 8;
+                    continue;
+                }
+            }
+
+            uint64_t value = 0;
+            int shift = 0;
+            while (true) {
+                if (p == end || shift > 63) {
+                    throw std::runtime_error("Corrupt varint data in serialized surface");
+                }
+                uint8_t byte = *p++;
+                value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+                if (!(byte & 0x80)) break;
+                shift += 7;
+            }
+            values[i++] = value;
+        }
+
+        if (p != end) {
+            throw std::runtime_error("Corrupt varint data in serialized surface");
+        }
+        pos_ = end;
+        return values;
+    }
+
+private:
+    size_t remaining() const {
+        return static_cast<size_t>(end_ - pos_);
+    }
+
+    void require(size_t bytes) const {
+        if (remaining() < bytes) {
+            throw std::runtime_error("Unexpected end of serialized surface");
+        }
+    }
+
+    const uint8_t* pos_;
+    const uint8_t* end_;
+};
+
+void write_raw(ByteWriter& writer, const InterfaceSurface& surface) {
+    writer.put<uint64_t>(surface.vertices.size());
+    for (const auto& v : surface.vertices) {
+        writer.put_array(v.data(), 3);
+    }
+
+    writer.put<uint64_t>(surface.generators.size());
+    writer.put_array(surface.generators.data(), surface.generators.size());
+
+    writer.put<uint64_t>(surface.filtration.size());
+    for (const auto& [simplex, value] : surface.filtration) {
+        writer.put<uint8_t>(static_cast<uint8_t>(simplex.size()));
+        writer.put_array(simplex.data(), simplex.size());
+        writer.put(value);
+    }
+}
+
+void read_raw(ByteReader& reader, InterfaceSurface& surface) {
+    surface.vertices.resize(reader.get_count(3 * sizeof(double)));
+    for (auto& v : surface.vertices) {
+        reader.get_array(v.data(), 3);
+    }
+
+    surface.generators.resize(reader.get_count(sizeof(GeneratingPoints)));
+    reader.get_array(surface.generators.data(), surface.generators.size());
+
+    // A size byte and a value per simplex
+    surface.filtration.resize(reader.get_count(sizeof(uint8_t) + sizeof(double)));
+    for (auto& [simplex, value] : surface.filtration) {
+        simplex.resize(reader.get<uint8_t>());
+        reader.get_array(simplex.data(), simplex.size());
+        value = reader.get<double>();
+    }
+}
+
+// Quantized values as zigzag deltas of their multiples of the quantum;
+// exact values as zigzag deltas of their bit patterns, which are small for
+// sorted non-negative doubles. Deltas wrap around in unsigned arithmetic.
+std::vector<uint64_t> encode_values(const std::vector<double>& values, double quantum) {
+    std::vector<uint64_t> encoded;
+    encoded.reserve(values.size());
+    uint64_t previous = 0;
+    for (double value : values) {
+        uint64_t current = quantum > 0
+            ? static_cast<uint64_t>(std::llround(value / quantum))
+            : double_bits(value);
+        encoded.push_back(zigzag(static_cast<int64_t>(current - previous)));
+        previous = current;
+    }
+    return encoded;
+}
+
+template<typename Output>
+void decode_values(const std::vector<uint64_t>& encoded, double quantum, Output output) {
+    uint64_t current = 0;
+    for (size_t i = 0; i < encoded.size(); ++i) {
+        current += static_cast<uint64_t>(unzigzag(encoded[i]));
+        output(i, quantum > 0 ? static_cast<double>(static_cast<int64_t>(current)) * quantum
+                              : bits_double(current));
+    }
+}
+
+void write_compressed(ByteWriter& writer, const InterfaceSurface& surface, const SerializationOptions& options) {
+    // Vertex coordinates
+    writer.put<uint64_t>(surface.vertices.size());
+    if (options.coordinate_quantum > 0) {
+        for (int axis = 0; axis < 3; ++axis) {
+            std::vector<double> coordinates;
+            coordinates.reserve(surface.vertices.size());
+            for (const auto& v : surface.vertices) coordinates.push_back(v[axis]);
+            writer.put_varints(encode_values(coordinates, options.coordinate_quantum));
+        }
+    } else {
+        for (const auto& v : surface.vertices) {
+            writer.put_array(v.data(), 3);
+        }
+    }
+
+    // Generators: count, then the first index relative to the previous
+    // vertex and the remaining ones relative to each other
+    std::vector<uint64_t> generators;
+    generators.reserve(surface.generators.size() * 4);
+    int64_t previous_first = 0;
+    for (const auto& generating : surface.generators) {
+        size_t count = 0;
+        while (count < 4 && generating[count] >= 0) ++count;
+        generators.push_back(count);
+        for (size_t k = 0; k < count; ++k) {
+            int64_t base = k == 0 ? previous_first : generating[k - 1];
+            generators.push_back(zigzag(generating[k] - base));
+        }
+        if (count > 0) previous_first = generating[0];
+    }
+    writer.put_varints(generators);
+
+    // Filtration, as runs of simplices of equal size. Within a run, the first
+    // vertex id is relative to the previous simplex and the others to the
+    // preceding id of the same simplex.
+    std::vector<size_t> run_starts;
+    for (size_t i = 0; i < surface.filtration.size(); ++i) {
+        if (i == 0 || std::get<0>(surface.filtration[i]).size() != std::get<0>(surface.filtration[i - 1]).size()) {
+            run_starts.push_back(i);
+        }
+    }
+    run_starts.push_back(surface.filtration.size());
+
+    writer.put<uint64_t>(run_starts.size() - 1);
+    for (size_t r = 0; r + 1 < run_starts.size(); ++r) {
+        size_t begin = run_starts[r], end = run_starts[r + 1];
+        size_t size = std::get<0>(surface.filtration[begin]).size();
+
+        std::vector<uint64_t> ids;
+        std::vector<double> values;
+        ids.reserve((end - begin) * size);
+        values.reserve(end - begin);
+
+        int64_t previous = 0;
+        for (size_t i = begin; i < end; ++i) {
+            const auto& [simplex, value] = surface.filtration[i];
+            for (size_t k = 0; k < size; ++k) {
+                int64_t base = k == 0 ? previous : simplex[k - 1];
+                ids.push_back(zigzag(simplex[k] - base));
+            }
+            previous = simplex[0];
+            values.push_back(value);
+        }
+
+        writer.put<uint8_t>(static_cast<uint8_t>(size));
+        writer.put_varints(ids);
+        writer.put_varints(encode_values(values, options.value_quantum));
+    }
+}
+
+void read_compressed(ByteReader& reader, InterfaceSurface& surface, double coordinate_quantum, double value_quantum) {
+    // Three varints of a byte or more, or three doubles, per vertex
+    surface.vertices.resize(reader.get_count(coordinate_quantum > 0 ? 3 : 3 * sizeof(double)));
+    if (coordinate_quantum > 0) {
+        for (int axis = 0; axis < 3; ++axis) {
+            auto encoded = reader.get_varints();
+            if (encoded.size() != surface.vertices.size()) {
+                throw std::runtime_error("Corrupt coordinates in serialized surface");
+            }
+            decode_values(encoded, coordinate_quantum,
+                [&](size_t i, double value) { surface.vertices[i][axis] = value; });
+        }
+    } else {
+        for (auto& v : surface.vertices) {
+            reader.get_array(v.data(), 3);
+        }
+    }
+
+    auto generators = reader.get_varints();
+    int64_t previous_first = 0;
+    for (size_t i = 0; i < generators.size();) {
+        GeneratingPoints generating;
+        generating.fill(-1);
+        size_t count = generators[i++];
+        if (count > 4 || i + count > generators.size()) {
+            throw std::runtime_error("Corrupt generators in serialized surface");
+        }
+        for (size_t k = 0; k < count; ++k) {
+            int64_t base = k == 0 ? previous_first : generating[k - 1];
+            generating[k] = static_cast<int>(base + unzigzag(generators[i++]));
+        }
+        if (count > 0) previous_first = generating[0];
+        surface.generators.push_back(generating);
+    }
+
+    for (uint64_t runs = reader.get<uint64_t>(); runs > 0; --runs) {
+        size_t size = reader.get<uint8_t>();
+        auto ids = reader.get_varints();
+        auto values = reader.get_varints();
+        if (size == 0 || ids.size() != values.size() * size) {
+            throw std::runtime_error("Corrupt filtration in serialized surface");
+        }
+
+        size_t begin = surface.filtration.size();
+        surface.filtration.resize(begin + values.size());
+
+        int64_t previous = 0;
+        for (size_t i = 0; i < values.size(); ++i) {
+            Simplex& simplex = std::get<0>(surface.filtration[begin + i]);
+            simplex.resize(size);
+            for (size_t k = 0; k < size; ++k) {
+                int64_t base = k == 0 ? previous : simplex[k - 1];
+                simplex[k] = static_cast<int32_t>(base + unzigzag(ids[i * size + k]));
+            }
+            previous = simplex[0];
+        }
+
+        decode_values(values, value_quantum,
+            [&](size_t i, double value) { std::get<1>(surface.filtration[begin + i]) = value; });
+    }
+}
+
+} // namespace
+
+std::string serialize_interface_surface(
+    const InterfaceSurface& surface,
+    const SerializationOptions& options
+) {
+    std::string out;
+    ByteWriter writer(out);
+
+    bool compressed = options.encoding == SurfaceEncoding::Compressed;
+    uint8_t flags = (surface.weighted ? kWeighted : 0) | (surface.alpha ? kAlpha : 0);
+
+    out.append(kSurfaceMagic, 8);
+    writer.put<uint8_t>(static_cast<uint8_t>(options.encoding));
+    writer.put<uint8_t>(flags);
+    writer.put<double>(compressed ? options.coordinate_quantum : 0.0);
+    writer.put<double>(compressed ? options.value_quantum : 0.0);
+
+    if (compressed) {
+        write_compressed(writer, surface, options);
+    } else {
+        write_raw(writer, surface);
+    }
+    return out;
+}
+
+InterfaceSurface deserialize_interface_surface(std::string_view data) {
+    if (data.size() < 8 || data.substr(0, 8) != std::string_view(kSurfaceMagic, 8)) {
+        throw std::runtime_error("Data is not a serialized interface surface");
+    }
+
+    ByteReader reader(data.substr(8));
+    auto encoding = static_cast<SurfaceEncoding>(reader.get<uint8_t>());
+    uint8_t flags = reader.get<uint8_t>();
+    double coordinate_quantum = reader.get<double>();
+    double value_quantum = reader.get<double>();
+
+    InterfaceSurface surface;
+    surface.weighted = flags & kWeighted;
+    surface.alpha = flags & kAlpha;
+
+    if (encoding == SurfaceEncoding::Compressed) {
+        read_compressed(reader, surface, coordinate_quantum, value_quantum);
+    } else if (encoding == SurfaceEncoding::Raw) {
+        read_raw(reader, surface);
+    } else {
+        throw std::runtime_error("Unknown surface encoding");
+    }
+    return surface;
+}
+
+void save_interface_surface(
+    const std::string& path,
+    const InterfaceSurface& surface,
+    const SerializationOptions& options
+) {
+    std::ofstream out(path, std::ios::binary);
+    if (!out) {
+        throw std::runtime_error("Cannot open '" + path + "' for writing");
+    }
+    auto data = serialize_interface_surface(surface, options);
+    out.write(data.data(), static_cast<std::streamsize>(data.size()));
+    if (!out) {
+        throw std::runtime_error("Failed writing '" + path + "'");
+    }
+}
+
+InterfaceSurface load_interface_surface(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        throw std::runtime_error("Cannot open '" + path + "'");
+    }
+    std::string data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    return deserialize_interface_surface(data);
+}
+
+} // namespace delaunay_interfaces
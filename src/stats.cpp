@@ -0,0 +1,20 @@
+#include "delaunay_interfaces/stats.hpp"
+#include <atomic>
+
+namespace delaunay_interfaces {
+
+namespace {
+
+std::atomic<StageObserver*> stage_observer{nullptr};
+
+} // namespace
+
+void set_stage_observer(StageObserver* observer) {
+    stage_observer.store(observer, std::memory_order_release);
+}
+
+StageObserver* get_stage_observer() {
+    return stage_observer.load(std::memory_order_acquire);
+}
+
+} // namespace delaunay_interfaces
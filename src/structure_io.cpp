@@ -0,0 +1,683 @@
+#include "delaunay_interfaces/structure_io.hpp"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <exception>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+
+namespace delaunay_interfaces {
+
+namespace {
+
+// Below this many bytes per thread, parsing is cheaper than spawning threads
+constexpr size_t kMinChunkBytes = 1 << 20;
+
+struct AtomRecord {
+    Point3D position;
+    double radius;
+    std::string group;
+};
+
+using Records = std::vector<AtomRecord>;
+
+// Bondi (1964) van der Waals radii, completed with Mantina et al. (2009)
+// for the alkali and alkaline earth metals
+const std::map<std::string, double, std::less<>>& vdw_radii() {
+    static const std::map<std::string, double, std::less<>> table = {
+        {"H", 1.20}, {"D", 1.20}, {"He", 1.40}, {"Li", 1.82}, {"C", 1.70},
+        {"N", 1.55}, {"O", 1.52}, {"F", 1.47}, {"Ne", 1.54}, {"Na", 2.27},
+        {"Mg", 1.73}, {"Si", 2.10}, {"P", 1.80}, {"S", 1.80}, {"Cl", 1.75},
+        {"Ar", 1.88}, {"K", 2.75}, {"Ni", 1.63}, {"Cu", 1.40}, {"Zn", 1.39},
+        {"Ga", 1.87}, {"As", 1.85}, {"Se", 1.90}, {"Br", 1.85}, {"Kr", 2.02},
+        {"Pd", 1.63}, {"Ag", 1.72}, {"Cd", 1.58}, {"In", 1.93}, {"Sn", 2.17},
+        {"Te", 2.06}, {"I", 1.98}, {"Xe", 2.16}, {"Pt", 1.75}, {"Au", 1.66},
+        {"Hg", 1.55}, {"Tl", 1.96}, {"Pb", 2.02}, {"U", 1.86}, {"Be", 1.53},
+        {"Ca", 2.31}, {"Rb", 3.03}, {"Sr", 2.49}, {"Cs", 3.43}, {"Ba", 2.68}
+    };
+    return table;
+}
+
+std::string_view trim(std::string_view s) {
+    while (!s.empty() && std::isspace(static_cast<unsigned char>(s.front()))) s.remove_prefix(1);
+    while (!s.empty() && std::isspace(static_cast<unsigned char>(s.back()))) s.remove_suffix(1);
+    return s;
+}
+
+// Fixed-width column (0-based start), clipped to the line
+std::string_view column(std::string_view line, size_t start, size_t length) {
+    if (start >= line.size()) return {};
+    return line.substr(start, length);
+}
+
+bool parse_number(std::string_view s, double& out) {
+    s = trim(s);
+    if (!s.empty() && s.front() == '+') s.remove_prefix(1);
+    auto result = std::from_chars(s.data(), s.data() + s.size(), out);
+    return !s.empty() && result.ec == std::errc() && result.ptr == s.data() + s.size();
+}
+
+std::string_view next_line(std::string_view& text) {
+    size_t end = text.find('\n');
+    std::string_view line = text.substr(0, end);
+    text.remove_prefix(end == std::string_view::npos ? text.size() : end + 1);
+    if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+    return line;
+}
+
+// Offset just past the `count`-th newline (or the end of the text)
+size_t skip_lines(std::string_view text, size_t count) {
+    size_t offset = 0;
+    for (size_t i = 0; i < count && offset < text.size(); ++i) {
+        size_t end = text.find('\n', offset);
+        offset = end == std::string_view::npos ? text.size() : end + 1;
+    }
+    return offset;
+}
+
+std::string normalize_element(std::string_view element) {
+    std::string result;
+    for (char c : trim(element)) {
+        if (!std::isalpha(static_cast<unsigned char>(c))) continue;
+        result += static_cast<char>(result.empty() ? std::toupper(c) : std::tolower(c));
+    }
+    return result;
+}
+
+bool is_hydrogen(const std::string& element) {
+    return element == "H" || element == "D";
+}
+
+bool is_water(std::string_view residue) {
+    residue = trim(residue);
+    return residue == "HOH" || residue == "WAT" || residue == "DOD" ||
+           residue == "H2O" || residue == "TIP" || residue == "TIP3" || residue == "SOL";
+}
+
+std::runtime_error parse_error(const char* format, std::string_view line) {
+    return std::runtime_error(std::string("Malformed ") + format + " record: '" + std::string(line) + "'");
+}
+
+// Split `text` into up to `count` pieces ending on line boundaries
+std::vector<std::string_view> split_chunks(std::string_view text, size_t count) {
+    std::vector<std::string_view> chunks;
+    size_t begin = 0;
+    for (size_t i = 1; i <= count && begin < text.size(); ++i) {
+        size_t end = i == count ? text.size() : text.size() * i / count;
+        if (end < begin) end = begin;
+        end = text.find('\n', end);
+        end = end == std::string_view::npos ? text.size() : end + 1;
+        chunks.push_back(text.substr(begin, end - begin));
+        begin = end;
+    }
+    return chunks;
+}
+
+// Run `parse_line(line, records)` over all lines of `body`, split across threads.
+// Records keep file order.
+template<typename ParseLine>
+Records parse_lines_parallel(std::string_view body, unsigned num_threads, ParseLine parse_line) {
+    size_t threads = num_threads ? num_threads : std::max(1u, std::thread::hardware_concurrency());
+    threads = std::max<size_t>(1, std::min(threads, body.size() / kMinChunkBytes + 1));
+
+    auto chunks = split_chunks(body, threads);
+    std::vector<Records> partial(chunks.size());
+    std::vector<std::exception_ptr> errors(chunks.size());
+
+    auto parse_chunk = [&](size_t i) {
+        try {
+            std::string_view rest = chunks[i];
+            partial[i].reserve(rest.size() / 64);
+            while (!rest.empty()) {
+                parse_line(next_line(rest), partial[i]);
+            }
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < chunks.size(); ++i) {
+        workers.emplace_back(parse_chunk, i);
+    }
+    if (!chunks.empty()) parse_chunk(0);
+    for (auto& worker : workers) worker.join();
+
+    for (const auto& error : errors) {
+        if (error) std::rethrow_exception(error);
+    }
+
+    if (partial.size() == 1) return std::move(partial[0]);
+
+    size_t total = 0;
+    for (const auto& records : partial) total += records.size();
+    Records result;
+    result.reserve(total);
+    for (auto& records : partial) {
+        std::move(records.begin(), records.end(), std::back_inserter(result));
+    }
+    return result;
+}
+
+StructureData assemble(Records&& records) {
+    StructureData data;
+    data.points.reserve(records.size());
+    data.color_labels.reserve(records.size());
+    data.radii.reserve(records.size());
+
+    std::unordered_map<std::string, int> labels;
+    for (auto& record : records) {
+        auto [it, inserted] = labels.emplace(record.group, static_cast<int>(labels.size()));
+        if (inserted) {
+            data.color_names.push_back(std::move(record.group));
+        }
+        data.points.push_back(record.position);
+        data.color_labels.push_back(it->second);
+        data.radii.push_back(record.radius);
+    }
+    return data;
+}
+
+double get_radius(const std::string& element, const StructureReadOptions& options) {
+    return get_vdw_radius(element, options.default_radius) + options.radius_offset;
+}
+
+// PDB atom names put one-letter elements in column 14 and two-letter ones in 13
+std::string element_from_atom_name(std::string_view name) {
+    if (name.size() < 2) return normalize_element(name);
+    if (name[0] == ' ' || std::isdigit(static_cast<unsigned char>(name[0]))) {
+        return normalize_element(name.substr(1, 1));
+    }
+    auto two = normalize_element(name.substr(0, 2));
+    if (two.size() == 2 && vdw_radii().count(two)) return two;
+    return normalize_element(name.substr(0, 1));
+}
+
+// Chain -> MOL_ID from the COMPND records
+std::unordered_map<std::string, std::string> parse_pdb_entities(std::string_view header) {
+    std::unordered_map<std::string, std::string> entities;
+    std::string mol_id;
+    std::string compnd;
+
+    while (!header.empty()) {
+        auto line = next_line(header);
+        if (line.substr(0, 6) == "COMPND") compnd += std::string(column(line, 10, 70)) + " ";
+    }
+
+    std::istringstream statements(compnd);
+    std::string statement;
+    while (std::getline(statements, statement, ';')) {
+        auto colon = statement.find(':');
+        if (colon == std::string::npos) continue;
+        auto key = trim(std::string_view(statement).substr(0, colon));
+        auto value = trim(std::string_view(statement).substr(colon + 1));
+        if (key == "MOL_ID") {
+            mol_id = std::string(value);
+        } else if (key == "CHAIN" && !mol_id.empty()) {
+            std::istringstream chains{std::string(value)};
+            std::string chain;
+            while (std::getline(chains, chain, ',')) {
+                entities[std::string(trim(chain))] = mol_id;
+            }
+        }
+    }
+    return entities;
+}
+
+StructureData parse_pdb(std::string_view text, const StructureReadOptions& options) {
+    // Only the first model is read
+    size_t body_begin = text.size();
+    for (std::string_view tag : {"ATOM  ", "HETATM", "MODEL "}) {
+        if (text.substr(0, tag.size()) == tag) {
+            body_begin = 0;
+            break;
+        }
+        size_t pos = text.find("\n" + std::string(tag));
+        if (pos != std::string_view::npos) body_begin = std::min(body_begin, pos + 1);
+    }
+    size_t body_end = std::min(text.find("\nENDMDL", body_begin), text.size());
+
+    auto entities = parse_pdb_entities(text.substr(0, body_begin));
+    auto body = text.substr(body_begin, body_end - body_begin);
+
+    auto records = parse_lines_parallel(body, options.num_threads,
+        [&](std::string_view line, Records& out) {
+            auto record = line.substr(0, 6);
+            bool hetatm = record == "HETATM";
+            if (record != "ATOM  " && !hetatm) return;
+            if (hetatm && !options.include_hetatm) return;
+
+            char alt_loc = line.size() > 16 ? line[16] : ' ';
+            if (alt_loc != ' ' && alt_loc != 'A') return;
+
+            auto residue_name = column(line, 17, 3);
+            if (!options.include_water && is_water(residue_name)) return;
+
+            auto element = normalize_element(column(line, 76, 2));
+            if (element.empty()) element = element_from_atom_name(column(line, 12, 4));
+            if (!options.include_hydrogens && is_hydrogen(element)) return;
+
+            AtomRecord atom;
+            double x, y, z;
+            if (!parse_number(column(line, 30, 8), x) ||
+                !parse_number(column(line, 38, 8), y) ||
+                !parse_number(column(line, 46, 8), z)) {
+                throw parse_error("PDB", line);
+            }
+            atom.position = Point3D(x, y, z);
+            atom.radius = get_radius(element, options);
+
+            std::string chain(trim(column(line, 21, 1)));
+            switch (options.coloring) {
+                case ColoringScheme::Chain:
+                    atom.group = chain;
+                    break;
+                case ColoringScheme::Residue:
+                    atom.group = chain + ":" + std::string(trim(column(line, 22, 4))) +
+                                 std::string(trim(column(line, 26, 1)));
+                    break;
+                case ColoringScheme::Entity: {
+                    auto it = entities.find(chain);
+                    atom.group = it != entities.end() ? it->second : chain;
+                    break;
+                }
+            }
+            out.push_back(std::move(atom));
+        });
+
+    return assemble(std::move(records));
+}
+
+// Whitespace-separated tokens, honoring CIF single and double quotes
+void tokenize_row(std::string_view line, std::vector<std::string_view>& tokens) {
+    tokens.clear();
+    size_t i = 0;
+    while (i < line.size()) {
+        while (i < line.size() && std::isspace(static_cast<unsigned char>(line[i]))) ++i;
+        if (i >= line.size()) break;
+
+        char quote = line[i];
+        if (quote == '\'' || quote == '"') {
+            size_t end = i + 1;
+            // A closing quote must be followed by whitespace or the end of line
+            while (end < line.size() && !(line[end] == quote &&
+                   (end + 1 == line.size() || std::isspace(static_cast<unsigned char>(line[end + 1]))))) {
+                ++end;
+            }
+            tokens.push_back(line.substr(i + 1, end - i - 1));
+            i = end + 1;
+        } else {
+            size_t end = i;
+            while (end < line.size() && !std::isspace(static_cast<unsigned char>(line[end]))) ++end;
+            tokens.push_back(line.substr(i, end - i));
+            i = end;
+        }
+    }
+}
+
+StructureData parse_mmcif(std::string_view text, const StructureReadOptions& options) {
+    size_t header_begin = text.find("_atom_site.");
+    if (header_begin == std::string_view::npos) {
+        throw std::runtime_error("mmCIF input has no _atom_site loop");
+    }
+
+    // Column names of the loop
+    std::unordered_map<std::string, size_t> columns;
+    std::string_view rest = text.substr(header_begin);
+    while (!rest.empty() && rest.substr(0, 11) == "_atom_site.") {
+        auto line = trim(next_line(rest));
+        size_t index = columns.size();
+        columns.emplace(std::string(line.substr(11)), index);
+    }
+
+    auto find_column = [&](std::initializer_list<const char*> names) -> long {
+        for (const char* name : names) {
+            auto it = columns.find(name);
+            if (it != columns.end()) return static_cast<long>(it->second);
+        }
+        return -1;
+    };
+
+    long col_x = find_column({"Cartn_x"});
+    long col_y = find_column({"Cartn_y"});
+    long col_z = find_column({"Cartn_z"});
+    long col_element = find_column({"type_symbol"});
+    long col_group = find_column({"group_PDB"});
+    long col_alt = find_column({"label_alt_id"});
+    long col_residue_name = find_column({"label_comp_id", "auth_comp_id"});
+    long col_chain = find_column({"auth_asym_id", "label_asym_id"});
+    long col_seq = find_column({"auth_seq_id", "label_seq_id"});
+    long col_ins = find_column({"pdbx_PDB_ins_code"});
+    long col_entity = find_column({"label_entity_id"});
+    long col_model = find_column({"pdbx_PDB_model_num"});
+
+    if (col_x < 0 || col_y < 0 || col_z < 0) {
+        throw std::runtime_error("mmCIF _atom_site loop has no Cartn_x/y/z columns");
+    }
+
+    // The loop ends at the next comment, loop or data item
+    size_t body_end = rest.size();
+    for (const char* terminator : {"\n#", "\nloop_", "\n_", "\ndata_"}) {
+        body_end = std::min(body_end, rest.find(terminator));
+    }
+    if (!rest.empty() && (rest[0] == '#' || rest[0] == '_')) body_end = 0;
+    auto body = rest.substr(0, body_end);
+
+    // Only the first model is read
+    std::string first_model;
+    if (col_model >= 0 && !body.empty()) {
+        std::vector<std::string_view> tokens;
+        std::string_view first = body;
+        tokenize_row(next_line(first), tokens);
+        if (static_cast<size_t>(col_model) < tokens.size()) first_model = std::string(tokens[col_model]);
+    }
+
+    auto field = [](const std::vector<std::string_view>& tokens, long index) -> std::string_view {
+        if (index < 0 || static_cast<size_t>(index) >= tokens.size()) return {};
+        auto value = tokens[index];
+        return value == "." || value == "?" ? std::string_view() : value;
+    };
+
+    auto records = parse_lines_parallel(body, options.num_threads,
+        [&](std::string_view line, Records& out) {
+            thread_local std::vector<std::string_view> tokens;
+            tokenize_row(line, tokens);
+            if (tokens.empty()) return;
+            if (tokens.size() < columns.size()) throw parse_error("mmCIF", line);
+
+            if (col_model >= 0 && field(tokens, col_model) != first_model) return;
+            if (!options.include_hetatm && field(tokens, col_group) == "HETATM") return;
+
+            auto alt_loc = field(tokens, col_alt);
+            if (!alt_loc.empty() && alt_loc != "A") return;
+            if (!options.include_water && is_water(field(tokens, col_residue_name))) return;
+
+            auto element = normalize_element(field(tokens, col_element));
+            if (!options.include_hydrogens && is_hydrogen(element)) return;
+
+            AtomRecord atom;
+            double x, y, z;
+            if (!parse_number(tokens[col_x], x) ||
+                !parse_number(tokens[col_y], y) ||
+                !parse_number(tokens[col_z], z)) {
+                throw parse_error("mmCIF", line);
+            }
+            atom.position = Point3D(x, y, z);
+            atom.radius = get_radius(element, options);
+
+            std::string chain(field(tokens, col_chain));
+            switch (options.coloring) {
+                case ColoringScheme::Chain:
+                    atom.group = chain;
+                    break;
+                case ColoringScheme::Residue:
+                    atom.group = chain + ":" + std::string(field(tokens, col_seq)) +
+                                 std::string(field(tokens, col_ins));
+                    break;
+                case ColoringScheme::Entity: {
+                    auto entity = field(tokens, col_entity);
+                    atom.group = entity.empty() ? chain : std::string(entity);
+                    break;
+                }
+            }
+            out.push_back(std::move(atom));
+        });
+
+    return assemble(std::move(records));
+}
+
+StructureData parse_xyz(std::string_view text, const StructureReadOptions& options) {
+    // Only the first frame is read
+    std::string_view rest = text;
+    double count;
+    if (!parse_number(next_line(rest), count) || count < 0) {
+        throw std::runtime_error("XYZ input must start with the atom count");
+    }
+    next_line(rest); // Comment line
+    auto body = rest.substr(0, skip_lines(rest, static_cast<size_t>(count)));
+
+    auto records = parse_lines_parallel(body, options.num_threads,
+        [&](std::string_view line, Records& out) {
+            thread_local std::vector<std::string_view> tokens;
+            tokenize_row(line, tokens);
+            if (tokens.empty()) return;
+            if (tokens.size() < 4) throw parse_error("XYZ", line);
+
+            auto element = normalize_element(tokens[0]);
+            if (!options.include_hydrogens && is_hydrogen(element)) return;
+
+            AtomRecord atom;
+            double x, y, z;
+            if (!parse_number(tokens[1], x) || !parse_number(tokens[2], y) || !parse_number(tokens[3], z)) {
+                throw parse_error("XYZ", line);
+            }
+            atom.position = Point3D(x, y, z);
+            atom.radius = get_radius(element, options);
+            // XYZ has no chains; an optional fifth column names the group
+            atom.group = tokens.size() > 4 ? std::string(tokens[4]) : std::string();
+            out.push_back(std::move(atom));
+        });
+
+    return assemble(std::move(records));
+}
+
+StructureData parse_csv(std::string_view text, const StructureReadOptions& options) {
+    std::string_view rest = text;
+    auto first = next_line(rest);
+
+    auto split = [](std::string_view line, std::vector<std::string_view>& fields) {
+        fields.clear();
+        while (true) {
+            size_t comma = line.find(',');
+            fields.push_back(trim(line.substr(0, comma)));
+            if (comma == std::string_view::npos) break;
+            line.remove_prefix(comma + 1);
+        }
+    };
+
+    // Without a header the columns are x, y, z, label, radius
+    long col_x = 0, col_y = 1, col_z = 2, col_group = 3, col_radius = 4, col_element = -1;
+
+    std::vector<std::string_view> fields;
+    split(first, fields);
+    double probe;
+    bool has_header = !fields.empty() && !parse_number(fields[0], probe);
+
+    if (has_header) {
+        col_x = col_y = col_z = col_group = col_radius = -1;
+        long col_label = -1, col_chain = -1, col_residue = -1, col_entity = -1;
+        for (size_t i = 0; i < fields.size(); ++i) {
+            std::string name(fields[i]);
+            std::transform(name.begin(), name.end(), name.begin(),
+                [](unsigned char c) { return std::tolower(c); });
+            long index = static_cast<long>(i);
+            if (name == "x") col_x = index;
+            else if (name == "y") col_y = index;
+            else if (name == "z") col_z = index;
+            else if (name == "radius") col_radius = index;
+            else if (name == "element") col_element = index;
+            else if (name == "chain") col_chain = index;
+            else if (name == "residue") col_residue = index;
+            else if (name == "entity") col_entity = index;
+            else if (name == "label" || name == "color" || name == "group") col_label = index;
+        }
+        if (col_x < 0 || col_y < 0 || col_z < 0) {
+            throw std::runtime_error("CSV header must name x, y and z columns");
+        }
+        long scheme_column = options.coloring == ColoringScheme::Chain ? col_chain
+                           : options.coloring == ColoringScheme::Residue ? col_residue
+                           : col_entity;
+        col_group = scheme_column >= 0 ? scheme_column : col_label;
+    } else {
+        rest = text;
+    }
+
+    auto records = parse_lines_parallel(rest, options.num_threads,
+        [&](std::string_view line, Records& out) {
+            thread_local std::vector<std::string_view> tokens;
+            if (trim(line).empty()) return;
+            split(line, tokens);
+
+            auto get = [&](long index) -> std::string_view {
+                return index >= 0 && static_cast<size_t>(index) < tokens.size() ? tokens[index] : std::string_view();
+            };
+
+            auto element = normalize_element(get(col_element));
+            if (!options.include_hydrogens && is_hydrogen(element)) return;
+
+            AtomRecord atom;
+            double x, y, z;
+            if (!parse_number(get(col_x), x) || !parse_number(get(col_y), y) || !parse_number(get(col_z), z)) {
+                throw parse_error("CSV", line);
+            }
+            atom.position = Point3D(x, y, z);
+
+            double radius;
+            if (!get(col_radius).empty()) {
+                if (!parse_number(get(col_radius), radius)) throw parse_error("CSV", line);
+                atom.radius = radius + options.radius_offset;
+            } else {
+                atom.radius = get_radius(element, options);
+            }
+
+            atom.group = std::string(get(col_group));
+            out.push_back(std::move(atom));
+        });
+
+    return assemble(std::move(records));
+}
+
+} // namespace
+
+double get_vdw_radius(std::string_view element, double fallback) {
+    auto normalized = normalize_element(element);
+    auto it = vdw_radii().find(normalized);
+    return it != vdw_radii().end() ? it->second : fallback;
+}
+
+StructureFormat get_structure_format(const std::string& path) {
+    auto dot = path.find_last_of('.');
+    std::string extension = dot == std::string::npos ? "" : path.substr(dot + 1);
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+        [](unsigned char c) { return std::tolower(c); });
+
+    if (extension == "pdb" || extension == "ent") return StructureFormat::PDB;
+    if (extension == "cif" || extension == "mmcif") return StructureFormat::MMCIF;
+    if (extension == "xyz") return StructureFormat::XYZ;
+    if (extension == "csv") return StructureFormat::CSV;
+    throw std::invalid_argument("Cannot infer structure format of '" + path + "'");
+}
+
+StructureData parse_structure(std::string_view text, const StructureReadOptions& options) {
+    switch (options.format) {
+        case StructureFormat::PDB: return parse_pdb(text, options);
+        case StructureFormat::MMCIF: return parse_mmcif(text, options);
+        case StructureFormat::XYZ: return parse_xyz(text, options);
+        case StructureFormat::CSV: return parse_csv(text, options);
+        case StructureFormat::Auto: break;
+    }
+    throw std::invalid_argument("parse_structure requires an explicit format");
+}
+
+StructureData read_structure(const std::string& path, const StructureReadOptions& options) {
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) {
+        throw std::runtime_error("Cannot open '" + path + "'");
+    }
+
+    std::string text(static_cast<size_t>(in.tellg()), '\0');
+    in.seekg(0);
+    in.read(text.data(), static_cast<std::streamsize>(text.size()));
+
+    StructureReadOptions resolved = options;
+    if (resolved.format == StructureFormat::Auto) {
+        resolved.format = get_structure_format(path);
+    }
+    return parse_structure(text, resolved);
+}
+
+StructureFrameReader::StructureFrameReader(const std::string& path, const StructureReadOptions& options)
+    : in_(path, std::ios::binary), options_(options) {
+    if (!in_) {
+        throw std::runtime_error("Cannot open '" + path + "'");
+    }
+    if (options_.format == StructureFormat::Auto) {
+        options_.format = get_structure_format(path);
+    }
+}
+
+bool StructureFrameReader::read_next_pdb(std::string& text) {
+    text = header_;
+    bool has_atoms = false;
+    std::string line;
+
+    while (std::getline(in_, line)) {
+        std::string_view record = std::string_view(line).substr(0, 6);
+        if (record == "ENDMDL") break;
+
+        bool atom = record == "ATOM  " || record == "HETATM";
+        if (!header_read_ && !atom && record != "MODEL ") {
+            // Entity records are repeated in front of every frame
+            header_ += line;
+            header_ += '\n';
+        } else {
+            header_read_ = true;
+        }
+        has_atoms = has_atoms || atom;
+        text += line;
+        text += '\n';
+    }
+    return has_atoms;
+}
+
+bool StructureFrameReader::read_next_xyz(std::string& text) {
+    std::string line;
+    while (std::getline(in_, line) && trim(line).empty()) {}
+    if (!in_) return false;
+
+    double count;
+    if (!parse_number(line, count) || count < 0) {
+        throw std::runtime_error("XYZ frame must start with the atom count");
+    }
+
+    text = line + '\n';
+    for (size_t i = 0; i < static_cast<size_t>(count) + 1 && std::getline(in_, line); ++i) {
+        text += line;
+        text += '\n';
+    }
+    return true;
+}
+
+bool StructureFrameReader::read_next(StructureData& frame) {
+    if (finished_) return false;
+
+    std::string text;
+    bool found = false;
+    switch (options_.format) {
+        case StructureFormat::PDB:
+            found = read_next_pdb(text);
+            break;
+        case StructureFormat::XYZ:
+            found = read_next_xyz(text);
+            break;
+        default:
+            text.assign(std::istreambuf_iterator<char>(in_), std::istreambuf_iterator<char>());
+            found = !text.empty();
+            finished_ = true;
+            break;
+    }
+
+    if (!found) {
+        finished_ = true;
+        return false;
+    }
+    frame = parse_structure(text, options_);
+    return true;
+}
+
+} // namespace delaunay_interfaces
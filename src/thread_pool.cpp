@@ -0,0 +1,187 @@
+#include "delaunay_interfaces/thread_pool.hpp"
+#include "delaunay_interfaces/trace.hpp"
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+#include <string>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace delaunay_interfaces {
+
+namespace {
+
+// Pool and deque index of the current worker thread
+thread_local const ThreadPool* current_pool = nullptr;
+thread_local size_t current_queue = 0;
+
+// Best effort: a pool keeps working if the CPU set is restricted (e.g. by cgroups)
+void pin_current_thread(int cpu) {
+#ifdef __linux__
+    if (cpu < 0) return;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)cpu;
+#endif
+}
+
+} // namespace
+
+ThreadPool::ThreadPool(size_t num_threads) : ThreadPool(ThreadPoolOptions{num_threads, {}}) {}
+
+ThreadPool::ThreadPool(const ThreadPoolOptions& options) {
+    size_t num_threads = options.num_threads;
+    if (num_threads == 0) {
+        num_threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    for (int cpu : options.cpu_affinity) {
+#ifdef __linux__
+        if (cpu < 0 || cpu >= CPU_SETSIZE) {
+#else
+        if (cpu < 0) {
+#endif
+            throw std::invalid_argument("Invalid CPU in cpu_affinity: " + std::to_string(cpu));
+        }
+    }
+
+    for (size_t i = 0; i < num_threads; ++i) {
+        queues_.push_back(std::make_unique<TaskQueue>());
+    }
+    for (size_t i = 0; i < num_threads; ++i) {
+        int cpu = options.cpu_affinity.empty() ? -1 : options.cpu_affinity[i % options.cpu_affinity.size()];
+        threads_.emplace_back([this, i, cpu] { worker_loop(i, cpu); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    for (auto& thread : threads_) {
+        thread.join();
+    }
+}
+
+void ThreadPool::submit(std::function<void()> task) {
+    size_t queue = current_pool == this
+        ? current_queue
+        : next_queue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+    {
+        // Counted under mutex_ so sleeping threads cannot miss it, and before
+        // the task is published so taking it can never drive the count below zero
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++queued_;
+    }
+    {
+        std::lock_guard<std::mutex> lock(queues_[queue]->mutex);
+        queues_[queue]->tasks.push_back(std::move(task));
+    }
+    wake_.notify_one();
+}
+
+bool ThreadPool::run_one(size_t preferred) {
+    std::function<void()> task;
+
+    for (size_t k = 0; k < queues_.size() && !task; ++k) {
+        auto& queue = *queues_[(preferred + k) % queues_.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty()) continue;
+
+        // Own work newest first (still cache-warm), stolen work oldest first
+        if (k == 0) {
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+        } else {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+        }
+    }
+
+    if (!task) return false;
+    --queued_;
+    task();
+    return true;
+}
+
+void ThreadPool::notify_all() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    wake_.notify_all();
+}
+
+void ThreadPool::worker_loop(size_t index, int cpu) {
+    pin_current_thread(cpu);
+    current_pool = this;
+    current_queue = index;
+    set_trace_thread_name("worker " + std::to_string(index));
+
+    while (true) {
+        if (run_one(index)) continue;
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        wake_.wait(lock, [&] { return stopping_ || queued_ > 0; });
+        if (stopping_ && queued_ == 0) return;
+    }
+}
+
+void ThreadPool::parallel_for(
+    size_t count,
+    const std::function<void(size_t begin, size_t end)>& body,
+    size_t grain
+) {
+    if (count == 0) return;
+    if (grain == 0) {
+        grain = default_grain(count);
+    }
+
+    const size_t num_chunks = (count + grain - 1) / grain;
+    std::atomic<size_t> remaining{num_chunks};
+    std::mutex error_mutex;
+    size_t error_chunk = num_chunks;
+    std::exception_ptr error;
+    TraceRecorder* trace = current_trace_recorder();
+
+    for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+        submit([&, chunk] {
+            TraceScope tracing(trace);
+            try {
+                TraceSpan span("chunk", "executor", static_cast<int64_t>(chunk));
+                body(chunk * grain, std::min(count, (chunk + 1) * grain));
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                if (chunk < error_chunk) {
+                    error_chunk = chunk;
+                    error = std::current_exception();
+                }
+            }
+            if (remaining.fetch_sub(1) == 1) {
+                notify_all();
+            }
+        });
+    }
+
+    // Help with the queued tasks instead of blocking a thread
+    const size_t preferred = current_pool == this ? current_queue : 0;
+    while (remaining > 0) {
+        if (run_one(preferred)) continue;
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        wake_.wait(lock, [&] { return remaining == 0 || queued_ > 0; });
+    }
+
+    if (error) std::rethrow_exception(error);
+}
+
+ThreadPool& default_thread_pool() {
+    static ThreadPool pool;
+    return pool;
+}
+
+} // namespace delaunay_interfaces
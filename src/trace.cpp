@@ -0,0 +1,139 @@
+#include "delaunay_interfaces/trace.hpp"
+#include <atomic>
+#include <fstream>
+#include <iomanip>
+#include <ostream>
+#include <stdexcept>
+
+namespace delaunay_interfaces {
+
+namespace {
+
+thread_local TraceRecorder* current_recorder = nullptr;
+thread_local std::string thread_name;
+
+std::atomic<uint32_t> next_thread_id{1};
+
+void write_escaped(std::ostream& out, const std::string& text) {
+    out << '"';
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            out << '\\' << c;
+        } else if (static_cast<unsigned char>(c) >= 0x20) {
+            out << c;
+        }
+    }
+    out << '"';
+}
+
+} // namespace
+
+uint32_t trace_thread_id() {
+    thread_local const uint32_t id = next_thread_id.fetch_add(1, std::memory_order_relaxed);
+    return id;
+}
+
+void set_trace_thread_name(std::string name) {
+    thread_name = std::move(name);
+}
+
+TraceRecorder* current_trace_recorder() {
+    return current_recorder;
+}
+
+TraceScope::TraceScope(TraceRecorder* recorder) : previous_(current_recorder) {
+    current_recorder = recorder;
+}
+
+TraceScope::~TraceScope() {
+    current_recorder = previous_;
+}
+
+TraceRecorder::TraceRecorder() : origin_(Clock::now()) {}
+
+void TraceRecorder::record(
+    const char* name,
+    const char* category,
+    Clock::time_point begin,
+    Clock::time_point end,
+    int64_t index
+) {
+    const uint32_t thread = trace_thread_id();
+    std::lock_guard<std::mutex> lock(mutex_);
+    events_.push_back(Event{
+        name,
+        category,
+        std::chrono::duration_cast<std::chrono::nanoseconds>(begin - origin_).count(),
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count(),
+        thread,
+        index
+    });
+    auto it = thread_names_.find(thread);
+    if (it == thread_names_.end()) {
+        thread_names_.emplace(thread, thread_name.empty() ? "thread " + std::to_string(thread) : thread_name);
+    }
+}
+
+std::vector<TraceRecorder::Event> TraceRecorder::get_events() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return events_;
+}
+
+void TraceRecorder::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    events_.clear();
+    thread_names_.clear();
+    origin_ = Clock::now();
+}
+
+void TraceRecorder::write_chrome_trace(std::ostream& out) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Timestamps are in microseconds, kept to the nanosecond
+    std::ios_base::fmtflags flags = out.flags();
+    std::streamsize precision = out.precision();
+    out << std::fixed << std::setprecision(3);
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    auto separate = [&] {
+        out << (first ? "\n" : ",\n");
+        first = false;
+    };
+
+    for (const auto& [thread, name] : thread_names_) {
+        separate();
+        out << "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":" << thread << ",\"args\":{\"name\":";
+        write_escaped(out, name);
+        out << "}}";
+    }
+    for (const auto& event : events_) {
+        separate();
+        out << "{\"ph\":\"X\",\"name\":";
+        write_escaped(out, event.name);
+        out << ",\"cat\":";
+        write_escaped(out, event.category);
+        out << ",\"pid\":1,\"tid\":" << event.thread
+            << ",\"ts\":" << event.begin_ns / 1e3
+            << ",\"dur\":" << event.duration_ns / 1e3;
+        if (event.index >= 0) {
+            out << ",\"args\":{\"index\":" << event.index << "}";
+        }
+        out << "}";
+    }
+    out << "\n]}\n";
+    out.flags(flags);
+    out.precision(precision);
+}
+
+void TraceRecorder::write_chrome_trace(const std::string& path) const {
+    std::ofstream out(path);
+    if (!out) {
+        throw std::runtime_error("Cannot open '" + path + "' for writing");
+    }
+    write_chrome_trace(out);
+    if (!out) {
+        throw std::runtime_error("Failed writing '" + path + "'");
+    }
+}
+
+} // namespace delaunay_interfaces
@@ -0,0 +1,120 @@
+#include "delaunay_interfaces/trajectory.hpp"
+#include "delaunay_interfaces/bounded_queue.hpp"
+#include "delaunay_interfaces/interface_generation.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <thread>
+
+namespace delaunay_interfaces {
+
+size_t process_trajectory(
+    const std::string& path,
+    const FrameWriter& write_frame,
+    const TrajectoryOptions& options
+) {
+    StructureFrameReader reader(path, options.read_options);
+
+    const size_t max_in_flight = std::max<size_t>(1, options.max_in_flight);
+    const unsigned compute_threads = std::max(1u, options.compute_threads);
+
+    BoundedQueue<TrajectoryFrame> to_compute(max_in_flight);
+    BoundedQueue<TrajectoryFrame> to_write(max_in_flight);
+
+    // Frames written so far; the reader waits while max_in_flight are pending
+    std::mutex mutex;
+    std::condition_variable frame_written;
+    size_t written = 0;
+    bool aborted = false;
+    std::exception_ptr error;
+
+    auto fail = [&](std::exception_ptr e) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!error) error = e;
+            aborted = true;
+        }
+        frame_written.notify_all();
+        to_compute.close();
+        to_write.close();
+    };
+
+    auto is_aborted = [&] {
+        std::lock_guard<std::mutex> lock(mutex);
+        return aborted;
+    };
+
+    std::thread read_stage([&] {
+        try {
+            for (size_t index = 0;; ++index) {
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    frame_written.wait(lock, [&] { return aborted || index - written < max_in_flight; });
+                    if (aborted) break;
+                }
+
+                TrajectoryFrame frame;
+                frame.index = index;
+                if (!reader.read_next(frame.structure)) break;
+                if (!to_compute.push(std::move(frame))) break;
+            }
+        } catch (...) {
+            fail(std::current_exception());
+        }
+        to_compute.close();
+    });
+
+    std::atomic<unsigned> running_computes{compute_threads};
+    std::vector<std::thread> compute_stage;
+    for (unsigned t = 0; t < compute_threads; ++t) {
+        compute_stage.emplace_back([&] {
+            try {
+                InterfaceGenerator generator;
+                while (auto frame = to_compute.pop()) {
+                    if (is_aborted()) break;
+                    const auto& structure = frame->structure;
+                    frame->surface = generator.compute_interface_surface(
+                        structure.points, structure.color_labels, structure.radii,
+                        options.weighted, options.alpha
+                    );
+                    if (!to_write.push(std::move(*frame))) break;
+                }
+            } catch (...) {
+                fail(std::current_exception());
+            }
+            if (--running_computes == 0) to_write.close();
+        });
+    }
+
+    // Write stage: restore frame order, which parallel computes may change
+    std::map<size_t, TrajectoryFrame> pending;
+    size_t next = 0;
+    try {
+        while (auto frame = to_write.pop()) {
+            if (is_aborted()) break;
+            pending.emplace(frame->index, std::move(*frame));
+            while (!pending.empty() && pending.begin()->first == next) {
+                write_frame(pending.begin()->second);
+                pending.erase(pending.begin());
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    written = ++next;
+                }
+                frame_written.notify_all();
+            }
+        }
+    } catch (...) {
+        fail(std::current_exception());
+    }
+
+    read_stage.join();
+    for (auto& thread : compute_stage) thread.join();
+
+    if (error) std::rethrow_exception(error);
+    return next;
+}
+
+} // namespace delaunay_interfaces
@@ -1,8 +1,32 @@
+#include <algorithm>
+#include <array>
 #include <iostream>
 #include <cassert>
+#include <chrono>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
 #include <delaunay_interfaces/interface_generation.hpp>
 #include <delaunay_interfaces/chromatic_partitioning.hpp>
+#include <delaunay_interfaces/mesh_export.hpp>
+#include <delaunay_interfaces/structure_io.hpp>
+#include <delaunay_interfaces/trajectory.hpp>
+#include <delaunay_interfaces/serialization.hpp>
+#include <delaunay_interfaces/filtration_arrays.hpp>
+#include <delaunay_interfaces/batch.hpp>
+#include <delaunay_interfaces/c_api.h>
+#include <delaunay_interfaces/async.hpp>
+#include <delaunay_interfaces/executor.hpp>
+#include <delaunay_interfaces/bounded_queue.hpp>
+#include <delaunay_interfaces/trace.hpp>
+#include <delaunay_interfaces/preflight.hpp>
 
 using namespace delaunay_interfaces;
 
@@ -119,6 +143,1139 @@ void test_input_validation() {
     std::cout << "  PASS\n";
 }
 
+void test_mesh_export() {
+    std::cout << "Test: Mesh Export\n";
+
+    Points points = {
+        {0.0, 0.0, 0.0},
+        {1.0, 0.0, 0.0},
+        {0.5, 1.0, 0.0},
+        {0.5, 0.5, 1.0},
+        {2.0, 0.0, 0.0},
+        {2.5, 1.0, 0.0}
+    };
+
+    ColorLabels colors = {1, 1, 1, 2, 2, 2};
+
+    InterfaceGenerator generator;
+    auto surface = generator.compute_interface_surface(points, colors, {}, false, false);
+    assert(surface.generators.size() == surface.vertices.size());
+
+    size_t triangles = 0;
+    for (const auto& [simplex, value] : surface.filtration) {
+        if (simplex.size() == 3) ++triangles;
+    }
+
+    auto dir = std::filesystem::temp_directory_path();
+    auto ply_path = (dir / "delaunay_interfaces_test.ply").string();
+    auto obj_path = (dir / "delaunay_interfaces_test.obj").string();
+
+    write_ply(ply_path, surface, colors);
+    {
+        std::ifstream in(ply_path, std::ios::binary);
+        std::string line;
+        std::getline(in, line);
+        assert(line == "ply");
+        size_t vertex_count = 0, face_count = 0;
+        while (std::getline(in, line) && line != "end_header") {
+            std::istringstream fields(line);
+            std::string keyword, element;
+            size_t count = 0;
+            if (fields >> keyword >> element >> count && keyword == "element") {
+                (element == "vertex" ? vertex_count : face_count) = count;
+            }
+        }
+        assert(vertex_count == surface.vertices.size());
+        assert(face_count == triangles);
+
+        // Native-endian body: x, y, z and filtration per vertex, then per face
+        // an index count, the indices, the filtration and both colors
+        auto read = [&](auto& value) {
+            in.read(reinterpret_cast<char*>(&value), sizeof(value));
+            assert(in);
+        };
+        for (const auto& vertex : surface.vertices) {
+            double x, y, z, value;
+            read(x);
+            read(y);
+            read(z);
+            read(value);
+            assert(x == vertex.x() && y == vertex.y() && z == vertex.z());
+        }
+        for (size_t face = 0; face < face_count; ++face) {
+            uint8_t count;
+            read(count);
+            assert(count == 3);
+            for (int corner = 0; corner < 3; ++corner) {
+                int32_t index;
+                read(index);
+                assert(index >= 0 && static_cast<size_t>(index) < vertex_count);
+            }
+            double value;
+            int32_t color_a, color_b;
+            read(value);
+            read(color_a);
+            read(color_b);
+            assert(color_a == 1 && color_b == 2);
+        }
+        assert(in.peek() == std::char_traits<char>::eof());
+    }
+
+    write_obj(obj_path, surface, colors);
+    {
+        std::ifstream in(obj_path);
+        std::string line;
+        size_t vertices = 0, faces = 0;
+        while (std::getline(in, line)) {
+            if (line.rfind("v ", 0) == 0) ++vertices;
+            if (line.rfind("f ", 0) == 0) ++faces;
+            if (line.rfind("g ", 0) == 0) assert(line == "g interface_1_2");
+        }
+        assert(vertices == surface.vertices.size());
+        assert(faces == triangles);
+    }
+
+    std::filesystem::remove(ply_path);
+    std::filesystem::remove(obj_path);
+    std::cout << "  PASS\n";
+}
+
+void test_structure_parsing() {
+    std::cout << "Test: Structure Parsing\n";
+
+    std::string pdb =
+        "COMPND    MOL_ID: 1;\n"
+        "COMPND   2 CHAIN: A, B;\n"
+        "ATOM      1  N   ALA A   1      11.104   6.134  -6.504  1.00  0.00           N\n"
+        "ATOM      2  CA  ALA A   1      11.639   6.071  -5.147  1.00  0.00           C\n"
+        "ATOM      3  CA BALA A   1      11.639   6.071  -5.147  1.00  0.00           C\n"
+        "ATOM      4  CA  GLY B   2      12.000   7.000  -4.000  1.00  0.00\n"
+        "HETATM    5  O   HOH B   3      14.000   8.000  -3.000  1.00  0.00           O\n";
+
+    StructureReadOptions options;
+    options.format = StructureFormat::PDB;
+
+    auto chains = parse_structure(pdb, options);
+    assert(chains.points.size() == 3);
+    assert(chains.color_names.size() == 2);
+    assert((chains.color_labels == ColorLabels{0, 0, 1}));
+    assert(std::abs(chains.radii[0] - 1.55) < 1e-10);
+    assert(std::abs(chains.radii[2] - 1.70) < 1e-10);
+    assert(std::abs(chains.points[1].z() + 5.147) < 1e-10);
+
+    options.coloring = ColoringScheme::Entity;
+    assert(parse_structure(pdb, options).color_names.size() == 1);
+
+    // Columns are mapped by name, author chain names win, and quoted tokens
+    // may hold quotes and spaces
+    std::string mmcif =
+        "data_test\n"
+        "#\n"
+        "loop_\n"
+        "_atom_site.group_PDB\n"
+        "_atom_site.id\n"
+        "_atom_site.label_atom_id\n"
+        "_atom_site.label_alt_id\n"
+        "_atom_site.label_comp_id\n"
+        "_atom_site.label_asym_id\n"
+        "_atom_site.label_entity_id\n"
+        "_atom_site.Cartn_x\n"
+        "_atom_site.Cartn_y\n"
+        "_atom_site.Cartn_z\n"
+        "_atom_site.type_symbol\n"
+        "_atom_site.auth_asym_id\n"
+        "_atom_site.pdbx_PDB_model_num\n"
+        "ATOM   1 'N A' . ALA A 1 11.104 6.134 -6.504 N   H 1\n"
+        "ATOM   2 CA    A ALA A 1 11.639 6.071 -5.147 'C' H 1\n"
+        "ATOM   3 CA    B ALA A 1 11.639 6.071 -5.147 C   H 1\n"
+        "ATOM   4 \"O5'\" . G   B 1 12.000 7.000 -4.000 O   L 1\n"
+        "HETATM 5 O     . HOH C 2 14.000 8.000 -3.000 O   L 1\n"
+        "ATOM   6 CA    . ALA A 1 0.000  0.000  0.000  C   H 2\n"
+        "#\n";
+
+    options.format = StructureFormat::MMCIF;
+    options.coloring = ColoringScheme::Chain;
+    auto cif = parse_structure(mmcif, options);
+    assert(cif.points.size() == 3);
+    assert((cif.color_names == std::vector<std::string>{"H", "L"}));
+    assert((cif.color_labels == ColorLabels{0, 0, 1}));
+    assert(std::abs(cif.radii[0] - 1.55) < 1e-10);
+    assert(std::abs(cif.radii[1] - 1.70) < 1e-10);
+    assert(std::abs(cif.radii[2] - 1.52) < 1e-10);
+    assert(std::abs(cif.points[1].z() + 5.147) < 1e-10);
+    assert(std::abs(cif.points[2].x() - 12.0) < 1e-10);
+
+    options.coloring = ColoringScheme::Entity;
+    assert(parse_structure(mmcif, options).color_names.size() == 1);
+
+    options.format = StructureFormat::CSV;
+    options.coloring = ColoringScheme::Chain;
+    auto csv = parse_structure("x,y,z,chain,radius\n0,0,0,A,1.5\n1,0,0,B,2.0\n", options);
+    assert(csv.points.size() == 2);
+    assert(csv.color_names[1] == "B");
+    assert(std::abs(csv.radii[1] - 2.0) < 1e-10);
+
+    std::cout << "  PASS\n";
+}
+
+void test_trajectory() {
+    std::cout << "Test: Trajectory Pipeline\n";
+
+    auto path = (std::filesystem::temp_directory_path() / "delaunay_interfaces_test.xyz").string();
+    {
+        std::ofstream out(path);
+        for (int frame = 0; frame < 5; ++frame) {
+            double shift = 0.1 * frame;
+            out << "6\nframe " << frame << "\n"
+                << "C 0 0 0 a\nC 1 0 0 a\nC 0.5 1 0 a\n"
+                << "O 0.5 0.5 " << 1.0 + shift << " b\nO 2 0 0 b\nO 2.5 1 0 b\n";
+        }
+    }
+
+    TrajectoryOptions options;
+    options.weighted = false;
+    options.alpha = false;
+    options.max_in_flight = 2;
+
+    std::vector<size_t> order;
+    size_t frames = process_trajectory(path, [&](const TrajectoryFrame& frame) {
+        assert(frame.structure.points.size() == 6);
+        assert(frame.surface.vertices.size() > 0);
+        order.push_back(frame.index);
+    }, options);
+
+    assert(frames == 5);
+    assert((order == std::vector<size_t>{0, 1, 2, 3, 4}));
+
+    std::filesystem::remove(path);
+    std::cout << "  PASS\n";
+}
+
+void test_checkpoint_resume() {
+    std::cout << "Test: Checkpoint Resume\n";
+
+    Points points = {
+        {0.0, 0.0, 0.0},
+        {1.0, 0.0, 0.0},
+        {0.5, 1.0, 0.0},
+        {0.5, 0.5, 1.0},
+        {2.0, 0.0, 0.0},
+        {2.5, 1.0, 0.0},
+        {2.5, 0.5, 1.0},
+        {1.5, 0.5, 0.5}
+    };
+
+    ColorLabels colors = {1, 1, 1, 1, 2, 2, 2, 2};
+
+    InterfaceGenerator reference;
+    auto expected = reference.compute_interface_surface(points, colors, {}, false, false);
+
+    CheckpointOptions checkpoint;
+    checkpoint.path = (std::filesystem::temp_directory_path() / "delaunay_interfaces_test").string();
+    checkpoint.interval = 1;
+
+    // The first run writes the triangulation, the second one reuses it
+    for (int run = 0; run < 2; ++run) {
+        auto [vertices, filtration] = get_barycentric_subdivision_and_filtration(
+            points, colors, {}, false, false, checkpoint);
+        assert(vertices == expected.vertices);
+        assert(filtration == expected.filtration);
+        assert(std::filesystem::exists(checkpoint.path + ".tri"));
+    }
+
+    auto triangulation = load_triangulation(checkpoint.path + ".tri");
+    assert(triangulation.input_hash == hash_triangulation_input(points, {}, false, false));
+    assert(triangulation.cells.size() == reference.get_tetrahedra(points, {}, false, false).size());
+
+    // A run cancelled part way through the subdivision resumes from its checkpoint
+    InterfaceGenerator interrupted;
+    interrupted.set_checkpoint_options(checkpoint);
+    interrupted.set_progress_callback([](const Progress& progress) {
+        return progress.stage != ComputationStage::Subdivision || progress.done < 2;
+    });
+    bool cancelled = false;
+    try {
+        interrupted.compute_interface_surface(points, colors, {}, false, false);
+    } catch (const OperationCancelled&) {
+        cancelled = true;
+    }
+    assert(cancelled);
+    assert(std::filesystem::exists(checkpoint.path + ".sub"));
+
+    std::vector<size_t> resumed_from;
+    interrupted.set_progress_callback([&](const Progress& progress) {
+        if (progress.stage == ComputationStage::Subdivision) resumed_from.push_back(progress.done);
+        return true;
+    });
+    auto resumed = interrupted.compute_interface_surface(points, colors, {}, false, false);
+    assert(resumed_from.size() > 1 && resumed_from[1] == 2);  // After the initial report
+    assert(resumed.vertices == expected.vertices);
+    assert(resumed.generators == expected.generators);
+    assert(resumed.filtration == expected.filtration);
+    assert(!std::filesystem::exists(checkpoint.path + ".sub"));
+
+    // Truncated or corrupt checkpoints are rejected before they size anything
+    auto resume_corrupted = [&](auto corrupt) {
+        std::filesystem::remove(checkpoint.path + ".sub");
+        interrupted.set_progress_callback([](const Progress& progress) {
+            return progress.stage != ComputationStage::Subdivision || progress.done < 2;
+        });
+        try {
+            interrupted.compute_interface_surface(points, colors, {}, false, false);
+        } catch (const OperationCancelled&) {
+        }
+        corrupt(checkpoint.path + ".sub");
+        interrupted.set_progress_callback(nullptr);
+        bool caught_exception = false;
+        try {
+            interrupted.compute_interface_surface(points, colors, {}, false, false);
+        } catch (const std::runtime_error& e) {
+            caught_exception = std::string(e.what()).find("Corrupt checkpoint") != std::string::npos;
+        }
+        assert(caught_exception);
+    };
+    resume_corrupted([](const std::string& path) {
+        std::filesystem::resize_file(path, std::filesystem::file_size(path) / 2);
+    });
+    resume_corrupted([](const std::string& path) {
+        // The barycenter count follows the tag, hash, processed cells and next id
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(8 + 8 + 8 + 4);
+        uint64_t huge = uint64_t(1) << 60;
+        file.write(reinterpret_cast<const char*>(&huge), sizeof(huge));
+    });
+
+    std::filesystem::remove(checkpoint.path + ".sub");
+    std::filesystem::remove(checkpoint.path + ".tri");
+    std::cout << "  PASS\n";
+}
+
+void test_serialization() {
+    std::cout << "Test: Surface Serialization\n";
+
+    Points points = {
+        {0.0, 0.0, 0.0},
+        {1.0, 0.0, 0.0},
+        {0.5, 1.0, 0.0},
+        {0.5, 0.5, 1.0},
+        {2.0, 0.0, 0.0},
+        {2.5, 1.0, 0.0},
+        {2.5, 0.5, 1.0},
+        {1.5, 0.5, 0.5}
+    };
+
+    ColorLabels colors = {1, 2, 1, 3, 2, 2, 3, 1};
+
+    InterfaceGenerator generator;
+    auto surface = generator.compute_interface_surface(points, colors, {}, false, false);
+
+    SerializationOptions raw;
+    raw.encoding = SurfaceEncoding::Raw;
+
+    auto raw_data = serialize_interface_surface(surface, raw);
+    auto compressed_data = serialize_interface_surface(surface);
+    assert(compressed_data.size() < raw_data.size());
+
+    for (const auto& data : {raw_data, compressed_data}) {
+        auto decoded = deserialize_interface_surface(data);
+        assert(decoded.vertices == surface.vertices);
+        assert(decoded.filtration == surface.filtration);
+        assert(decoded.generators == surface.generators);
+    }
+
+    SerializationOptions quantized;
+    quantized.value_quantum = 1e-6;
+    auto decoded = deserialize_interface_surface(serialize_interface_surface(surface, quantized));
+    for (size_t i = 0; i < surface.filtration.size(); ++i) {
+        assert(std::get<0>(decoded.filtration[i]) == std::get<0>(surface.filtration[i]));
+        assert(std::abs(std::get<1>(decoded.filtration[i]) - std::get<1>(surface.filtration[i])) <= 0.5e-6);
+    }
+
+    // Counts larger than the data are rejected before anything is allocated
+    SerializationOptions quantized_coordinates;
+    quantized_coordinates.coordinate_quantum = 1e-6;
+    const size_t header_size = 8 + 2 + 2 * sizeof(double);
+    const uint64_t huge = uint64_t(1) << 60;
+    auto corrupt = [&](std::string data, size_t offset) {
+        std::memcpy(&data[offset], &huge, sizeof(huge));
+        bool caught_exception = false;
+        try {
+            deserialize_interface_surface(data);
+        } catch (const std::runtime_error&) {
+            caught_exception = true;
+        }
+        assert(caught_exception);
+    };
+    // The vertex count, then the varint count of the first quantized axis
+    corrupt(raw_data, header_size);
+    corrupt(compressed_data, header_size);
+    corrupt(serialize_interface_surface(surface, quantized_coordinates), header_size + sizeof(uint64_t));
+
+    std::cout << "  PASS\n";
+}
+
+void test_array_views() {
+    std::cout << "Test: Array View Input\n";
+
+    // Flat buffers as handed over by NumPy
+    std::vector<double> xyz = {
+        0.0, 0.0, 0.0,
+        1.0, 0.0, 0.0,
+        0.5, 1.0, 0.0,
+        0.5, 0.5, 1.0,
+        2.0, 0.0, 0.0,
+        2.5, 1.0, 0.0
+    };
+    int labels[] = {1, 1, 1, 2, 2, 2};
+
+    Points points;
+    for (size_t i = 0; i < xyz.size(); i += 3) {
+        points.emplace_back(xyz[i], xyz[i + 1], xyz[i + 2]);
+    }
+    ColorLabels colors(std::begin(labels), std::end(labels));
+
+    InterfaceGenerator generator;
+    auto from_vectors = generator.compute_interface_surface(points, colors, {}, false, false);
+    auto from_views = generator.compute_interface_surface(
+        PointsView(xyz.data(), xyz.size() / 3), ColorLabelsView(labels, 6), {}, false, false);
+
+    assert(from_views.vertices == from_vectors.vertices);
+    assert(from_views.filtration == from_vectors.filtration);
+
+    std::cout << "  PASS\n";
+}
+
+void test_filtration_arrays() {
+    std::cout << "Test: Filtration Arrays\n";
+
+    Points points = {
+        {0.0, 0.0, 0.0},
+        {1.0, 0.0, 0.0},
+        {0.5, 1.0, 0.0},
+        {0.5, 0.5, 1.0},
+        {2.0, 0.0, 0.0},
+        {2.5, 1.0, 0.0}
+    };
+
+    ColorLabels colors = {1, 1, 1, 2, 2, 2};
+
+    InterfaceGenerator generator;
+    auto surface = generator.compute_interface_surface(points, colors, {}, false, false);
+    auto arrays = get_filtration_arrays(surface);
+
+    assert(arrays.vertex_values.size() == surface.vertices.size());
+    assert(arrays.edges.size() == 2 * arrays.edge_values.size());
+    assert(arrays.triangles.size() == 3 * arrays.triangle_values.size());
+    assert(surface.vertices.size() + arrays.edge_values.size() + arrays.triangle_values.size() ==
+           surface.filtration.size());
+
+    // Triangles keep their filtration order and use 0-based vertex positions
+    size_t t = 0;
+    for (const auto& [simplex, value] : surface.filtration) {
+        if (simplex.size() == 3) {
+            for (int k = 0; k < 3; ++k) {
+                assert(arrays.triangles[3 * t + k] == simplex[k] - 1);
+            }
+            assert(arrays.triangle_values[t] == value);
+            ++t;
+        }
+    }
+
+    std::cout << "  PASS\n";
+}
+
+void test_shared_generator() {
+    std::cout << "Test: Generator Shared Between Threads\n";
+
+    Points points = {
+        {0.0, 0.0, 0.0},
+        {1.0, 0.0, 0.0},
+        {0.5, 1.0, 0.0},
+        {0.5, 0.5, 1.0},
+        {2.0, 0.0, 0.0},
+        {2.5, 1.0, 0.0}
+    };
+
+    ColorLabels colors = {1, 1, 1, 2, 2, 2};
+
+    const InterfaceGenerator generator;
+    auto expected = generator.compute_interface_surface(points, colors, {}, false, false);
+
+    std::vector<InterfaceSurface> results(4);
+    std::vector<std::thread> threads;
+    for (auto& result : results) {
+        threads.emplace_back([&] {
+            result = generator.compute_interface_surface(points, colors, {}, false, false);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (const auto& result : results) {
+        assert(result.vertices == expected.vertices);
+        assert(result.filtration == expected.filtration);
+    }
+
+    std::cout << "  PASS\n";
+}
+
+void test_batch() {
+    std::cout << "Test: Batch Computation\n";
+
+    // Shifted copies of one cloud, concatenated
+    Points base = {
+        {0.0, 0.0, 0.0},
+        {1.0, 0.0, 0.0},
+        {0.5, 1.0, 0.0},
+        {0.5, 0.5, 1.0},
+        {2.0, 0.0, 0.0},
+        {2.5, 1.0, 0.0}
+    };
+    ColorLabels base_colors = {1, 1, 1, 2, 2, 2};
+
+    const size_t num_clouds = 50;
+    Points points;
+    ColorLabels colors;
+    std::vector<int64_t> offsets = {0};
+    for (size_t i = 0; i < num_clouds; ++i) {
+        // Every other cloud has one point less, so results differ by position
+        size_t size = base.size() - i % 2;
+        for (size_t k = 0; k < size; ++k) {
+            points.push_back(base[k] + Point3D(i, 0.0, 0.0));
+            colors.push_back(base_colors[k]);
+        }
+        offsets.push_back(points.size());
+    }
+
+    auto clouds = split_point_clouds(points, colors, {}, offsets);
+    assert(clouds.size() == num_clouds);
+
+    BatchOptions options;
+    options.weighted = false;
+    options.alpha = false;
+    options.num_threads = 4;
+    auto surfaces = compute_interface_surfaces(clouds, options);
+    assert(surfaces.size() == num_clouds);
+
+    InterfaceGenerator generator;
+    for (size_t i = 0; i < num_clouds; ++i) {
+        auto expected = generator.compute_interface_surface(
+            clouds[i].points, clouds[i].color_labels, {}, false, false);
+        assert(surfaces[i].vertices == expected.vertices);
+        assert(surfaces[i].filtration == expected.filtration);
+    }
+
+    // A failing input is reported after the batch completes
+    clouds[7].color_labels = ColorLabelsView(colors.data(), 1);
+    bool caught_exception = false;
+    try {
+        compute_interface_surfaces(clouds, options);
+    } catch (const std::invalid_argument&) {
+        caught_exception = true;
+    }
+    assert(caught_exception);
+
+    std::cout << "  PASS\n";
+}
+
+void test_c_api() {
+    std::cout << "Test: C API\n";
+
+    double xyz[] = {
+        0.0, 0.0, 0.0,
+        1.0, 0.0, 0.0,
+        0.5, 1.0, 0.0,
+        0.5, 0.5, 1.0,
+        2.0, 0.0, 0.0,
+        2.5, 1.0, 0.0
+    };
+    int32_t labels[] = {1, 1, 1, 2, 2, 2};
+    di_point_cloud cloud = {xyz, labels, nullptr, 6};
+
+    di_generator* generator = nullptr;
+    assert(di_generator_create(&generator) == DI_OK);
+
+    di_surface* surface = nullptr;
+    assert(di_compute_interface_surface(generator, &cloud, 0, 0, &surface) == DI_OK);
+
+    di_surface_sizes sizes;
+    assert(di_surface_get_sizes(surface, &sizes) == DI_OK);
+
+    std::vector<double> vertices(3 * sizes.num_vertices);
+    std::vector<int32_t> triangles(3 * sizes.num_triangles);
+    std::vector<double> triangle_values(sizes.num_triangles);
+
+    di_surface_buffers buffers = {};
+    buffers.vertices = vertices.data();
+    buffers.vertex_capacity = sizes.num_vertices;
+    buffers.triangles = triangles.data();
+    buffers.triangle_values = triangle_values.data();
+    buffers.triangle_capacity = sizes.num_triangles - 1;
+    buffers.index_base = 1;
+    assert(di_surface_copy(surface, &buffers) == DI_BUFFER_TOO_SMALL);
+
+    buffers.triangle_capacity = sizes.num_triangles;
+    assert(di_surface_copy(surface, &buffers) == DI_OK);
+
+    // Same result as the C++ API, with 1-based indices
+    Points points;
+    for (size_t i = 0; i < 6; ++i) {
+        points.emplace_back(xyz[3 * i], xyz[3 * i + 1], xyz[3 * i + 2]);
+    }
+    auto expected = InterfaceGenerator().compute_interface_surface(
+        points, ColorLabels(labels, labels + 6), {}, false, false);
+    auto arrays = get_filtration_arrays(expected);
+    assert(sizes.num_vertices == expected.vertices.size());
+    assert(std::equal(vertices.begin(), vertices.end(), expected.vertices.data()->data()));
+    for (size_t i = 0; i < triangles.size(); ++i) {
+        assert(triangles[i] == arrays.triangles[i] + 1);
+    }
+    assert(triangle_values == arrays.triangle_values);
+
+    di_surface_destroy(surface);
+
+    // Errors are reported as codes with a message
+    // (weighted, but no radii)
+    assert(di_compute_interface_surface(generator, &cloud, 1, 1, &surface) == DI_INVALID_ARGUMENT);
+    assert(surface == nullptr);
+    assert(std::string(di_last_error_message()).size() > 0);
+
+    di_generator_destroy(generator);
+
+    std::cout << "  PASS\n";
+}
+
+void test_progress_and_cancellation() {
+    std::cout << "Test: Progress and Cancellation\n";
+
+    Points points = {
+        {0.0, 0.0, 0.0},
+        {1.0, 0.0, 0.0},
+        {0.5, 1.0, 0.0},
+        {0.5, 0.5, 1.0},
+        {2.0, 0.0, 0.0},
+        {2.5, 1.0, 0.0}
+    };
+
+    ColorLabels colors = {1, 1, 1, 2, 2, 2};
+
+    InterfaceGenerator generator;
+    std::vector<Progress> reports;
+    generator.set_progress_callback([&](const Progress& progress) {
+        reports.push_back(progress);
+        return true;
+    });
+    generator.compute_interface_surface(points, colors, {}, false, false);
+
+    // Every stage reports its completion, in pipeline order
+    std::vector<ComputationStage> completed;
+    for (const auto& report : reports) {
+        assert(report.done <= report.total || report.total == 0);
+        if (report.done == report.total) completed.push_back(report.stage);
+    }
+    assert(!completed.empty() && completed.back() == ComputationStage::Sorting);
+    assert(std::find(completed.begin(), completed.end(), ComputationStage::Subdivision) != completed.end());
+
+    generator.set_progress_callback([](const Progress& progress) {
+        return progress.stage != ComputationStage::Subdivision;
+    });
+    bool cancelled = false;
+    try {
+        generator.compute_interface_surface(points, colors, {}, false, false);
+    } catch (const OperationCancelled&) {
+        cancelled = true;
+    }
+    assert(cancelled);
+
+    std::cout << "  PASS\n";
+}
+
+void test_async() {
+    std::cout << "Test: Asynchronous Computation\n";
+
+    SurfaceRequest request;
+    request.points = {
+        {0.0, 0.0, 0.0},
+        {1.0, 0.0, 0.0},
+        {0.5, 1.0, 0.0},
+        {0.5, 0.5, 1.0},
+        {2.0, 0.0, 0.0},
+        {2.5, 1.0, 0.0}
+    };
+    request.color_labels = {1, 1, 1, 2, 2, 2};
+    request.weighted = false;
+    request.alpha = false;
+
+    InterfaceGenerator generator;
+    auto expected = generator.compute_interface_surface(
+        request.points, request.color_labels, {}, false, false);
+
+    ThreadPool pool(2);
+    std::vector<std::future<InterfaceSurface>> futures;
+    for (int i = 0; i < 8; ++i) {
+        futures.push_back(compute_interface_surface_async(generator, request, pool));
+    }
+    for (auto& future : futures) {
+        auto surface = future.get();
+        assert(surface.vertices == expected.vertices);
+        assert(surface.filtration == expected.filtration);
+    }
+
+    // Errors arrive through the future
+    request.weighted = true;
+    auto failing = compute_interface_surface_async(generator, request);
+    bool caught_exception = false;
+    try {
+        failing.get();
+    } catch (const std::invalid_argument&) {
+        caught_exception = true;
+    }
+    assert(caught_exception);
+
+    std::cout << "  PASS\n";
+}
+
+void test_executors() {
+    std::cout << "Test: Executors\n";
+
+    // An application scheduler behind the Executor interface
+    ThreadPool application_pool(3);
+    auto executor = std::make_shared<FunctionExecutor>(
+        [&](std::function<void()> task) { application_pool.submit(std::move(task)); }, 3);
+
+    // Sorting splits into parallel chunks above a size threshold
+    std::vector<uint32_t> unsorted(100000);
+    uint32_t state = 12345;
+    for (auto& value : unsorted) {
+        state = state * 1664525u + 1013904223u;
+        value = state >> 8;
+    }
+    auto expected_values = unsorted;
+    std::sort(expected_values.begin(), expected_values.end());
+    auto values = unsorted;
+    parallel_sort(values.begin(), values.end(), std::less<uint32_t>(), executor.get());
+    assert(values == expected_values);
+
+    // A scheduler that runs nothing before the caller returns, like an arena
+    // whose threads are all busy: the calling thread does all the chunks
+    std::vector<std::function<void()>> deferred;
+    FunctionExecutor deferring([&](std::function<void()> task) { deferred.push_back(std::move(task)); }, 4);
+    values = unsorted;
+    parallel_sort(values.begin(), values.end(), std::less<uint32_t>(), &deferring);
+    assert(values == expected_values);
+    assert(!deferred.empty());
+    for (auto& task : deferred) task();  // Late tasks find nothing left
+
+    Points points = {
+        {0.0, 0.0, 0.0},
+        {1.0, 0.0, 0.0},
+        {0.5, 1.0, 0.0},
+        {0.5, 0.5, 1.0},
+        {2.0, 0.0, 0.0},
+        {2.5, 1.0, 0.0},
+        {1.5, 1.5, 1.0}
+    };
+    ColorLabels color_labels = {1, 1, 1, 2, 2, 2, 3};
+
+    InterfaceGenerator generator;
+    auto expected = generator.compute_interface_surface(points, color_labels, {}, false, false);
+
+    generator.set_executor(executor);
+    auto surface = generator.compute_interface_surface(points, color_labels, {}, false, false);
+    assert(surface.vertices == expected.vertices);
+    assert(surface.filtration == expected.filtration);
+
+    // A pinned pool, used from inside its own tasks
+    ThreadPoolOptions options;
+    options.num_threads = 2;
+    options.cpu_affinity = {0};
+    auto pinned = std::make_shared<ThreadPool>(options);
+    generator.set_executor(pinned);
+    SurfaceRequest request{points, color_labels, {}, false, false};
+    auto nested = compute_interface_surface_async(generator, request, *pinned);
+    assert(nested.get().filtration == expected.filtration);
+
+    bool caught_exception = false;
+    try {
+        ThreadPoolOptions invalid;
+        invalid.cpu_affinity = {-1};
+        ThreadPool pool(invalid);
+    } catch (const std::invalid_argument&) {
+        caught_exception = true;
+    }
+    assert(caught_exception);
+
+    std::cout << "  PASS\n";
+}
+
+void test_pipelined_subdivision() {
+    std::cout << "Test: Pipelined Subdivision\n";
+
+    // Queue order across threads, with a producer that often finds it full
+    SpscQueue<int> queue(4);
+    std::thread producer([&] {
+        Backoff backoff;
+        for (int i = 0; i < 10000; ++i) {
+            int item = i;
+            while (!queue.try_push(item)) backoff.wait();
+        }
+        queue.close();
+    });
+    int expected_item = 0;
+    while (auto item = queue.pop()) {
+        assert(*item == expected_item++);
+    }
+    producer.join();
+    assert(expected_item == 10000);
+
+    Points points;
+    ColorLabels color_labels;
+    uint32_t state = 7;
+    auto next = [&] {
+        state = state * 1664525u + 1013904223u;
+        return (state >> 8) / double(1u << 24);
+    };
+    for (int i = 0; i < 24; ++i) {
+        points.push_back(Point3D(next(), next(), next()));
+        color_labels.push_back(i % 3);
+    }
+
+    InterfaceGenerator generator;
+    auto expected = generator.compute_interface_surface(points, color_labels, {}, false, false);
+
+    auto check = [&](const InterfaceSurface& surface) {
+        assert(surface.vertices == expected.vertices);
+        assert(surface.generators == expected.generators);
+        assert(surface.filtration == expected.filtration);
+    };
+
+    generator.set_executor(std::make_shared<ThreadPool>(4));
+    check(generator.compute_interface_surface(points, color_labels, {}, false, false));
+
+    // A consumer task that has not started when extraction ends is taken over
+    std::vector<std::function<void()>> deferred;
+    generator.set_executor(std::make_shared<FunctionExecutor>(
+        [&](std::function<void()> task) { deferred.push_back(std::move(task)); }, 2));
+    check(generator.compute_interface_surface(points, color_labels, {}, false, false));
+    for (auto& task : deferred) {
+        task();
+    }
+
+    // Cancelling from the consumer stops the producer
+    generator.set_executor(std::make_shared<ThreadPool>(2));
+    generator.set_progress_callback([](const Progress& progress) {
+        return progress.stage != ComputationStage::Subdivision || progress.done == 0;
+    });
+    bool caught_exception = false;
+    try {
+        generator.compute_interface_surface(points, color_labels, {}, false, false);
+    } catch (const OperationCancelled&) {
+        caught_exception = true;
+    }
+    assert(caught_exception);
+
+    std::cout << "  PASS\n";
+}
+
+void test_computation_stats() {
+    std::cout << "Test: Computation Stats\n";
+
+    Points points = {
+        {0.0, 0.0, 0.0},
+        {1.0, 0.0, 0.0},
+        {0.5, 1.0, 0.0},
+        {0.5, 0.5, 1.0},
+        {2.0, 0.0, 0.0},
+        {2.5, 1.0, 0.0},
+        {2.5, 0.5, 1.0},
+        {1.5, 0.5, 0.5}
+    };
+    ColorLabels colors = {1, 2, 1, 3, 2, 2, 3, 1};
+
+    InterfaceGenerator generator;
+    // Off by default
+    assert(!generator.get_stats_options().enabled);
+    assert(!generator.compute_interface_surface(points, colors, {}, false, false).stats);
+    StatsOptions stats_options;
+    stats_options.enabled = true;
+    generator.set_stats_options(stats_options);
+    // So are the predicate counts
+    auto uncounted = generator.compute_interface_surface(points, colors, {}, false, false);
+    assert(uncounted.stats->predicates[static_cast<size_t>(PredicateType::Orientation)].evaluations == 0);
+    stats_options.predicates = true;
+    generator.set_stats_options(stats_options);
+
+    auto check = [&](const InterfaceSurface& surface) {
+        assert(surface.stats);
+        const auto& stats = *surface.stats;
+        assert(stats.points_inserted == points.size());
+        assert(stats.hidden_points == 0);
+        assert(stats.multicolored_cells > 0 && stats.multicolored_cells <= stats.finite_cells);
+
+        size_t by_partition = 0;
+        for (size_t count : stats.cells_by_partition) by_partition += count;
+        assert(by_partition == stats.multicolored_cells);
+
+        assert(stats.simplex_misses == surface.vertices.size());
+        assert(stats.simplices_by_dimension[0] == surface.vertices.size());
+        assert(stats.simplices_by_dimension[0] + stats.simplices_by_dimension[1] +
+               stats.simplices_by_dimension[2] == surface.filtration.size());
+        for (const auto& stage : stats.stages) {
+            assert(stage.wall_seconds >= 0 && stage.cpu_seconds >= 0);
+        }
+        // Memory is estimated only on request
+        assert(stats.memory.peak_bytes == 0 && stats.memory.peak_rss_bytes == 0);
+
+        const auto& orientations = stats.predicates[static_cast<size_t>(PredicateType::Orientation)];
+        assert(orientations.evaluations == stats.finite_cells);
+        assert(orientations.degenerate == 0);  // Cells are never flat
+    };
+
+    auto sequential = generator.compute_interface_surface(points, colors, {}, false, false);
+    check(sequential);
+
+    generator.set_executor(std::make_shared<ThreadPool>(2));
+    auto pipelined = generator.compute_interface_surface(points, colors, {}, false, false);
+    check(pipelined);
+    assert(pipelined.stats->cells_by_partition == sequential.stats->cells_by_partition);
+    assert(pipelined.stats->simplex_hits == sequential.stats->simplex_hits);
+
+    // Pipelined subdivision is timed from its first block, not through triangulation
+    const auto pause = std::chrono::milliseconds(100);
+    generator.set_progress_callback([&](const Progress& progress) {
+        if (progress.stage == ComputationStage::Triangulation && progress.done == 0) {
+            std::this_thread::sleep_for(pause);
+        }
+        return true;
+    });
+    auto started = std::chrono::steady_clock::now();
+    auto slowed = generator.compute_interface_surface(points, colors, {}, false, false);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - started;
+    assert(elapsed >= pause);
+    assert(slowed.stats->stage(ComputationStage::Subdivision).wall_seconds <
+           elapsed.count() - std::chrono::duration<double>(pause).count());
+    generator.set_progress_callback(nullptr);
+
+    // A lattice puts the corners of each cube on one sphere
+    Points lattice;
+    ColorLabels lattice_colors;
+    for (int x = 0; x < 3; ++x) {
+        for (int y = 0; y < 3; ++y) {
+            for (int z = 0; z < 3; ++z) {
+                lattice.push_back({double(x), double(y), double(z)});
+                lattice_colors.push_back((x + y + z) % 2 + 1);
+            }
+        }
+    }
+    auto degenerate = generator.compute_interface_surface(lattice, lattice_colors, {}, false, false);
+    assert(degenerate.stats->predicates[static_cast<size_t>(PredicateType::InSphere)].degenerate > 0);
+
+    // Stats describe a computation and are not stored
+    assert(!deserialize_interface_surface(serialize_interface_surface(sequential)).stats);
+
+    std::cout << "  PASS\n";
+}
+
+void test_memory_stats() {
+    std::cout << "Test: Memory Stats\n";
+
+    Points points = {
+        {0.0, 0.0, 0.0},
+        {1.0, 0.0, 0.0},
+        {0.5, 1.0, 0.0},
+        {0.5, 0.5, 1.0},
+        {2.0, 0.0, 0.0},
+        {2.5, 1.0, 0.0},
+        {2.5, 0.5, 1.0},
+        {1.5, 0.5, 0.5}
+    };
+    ColorLabels colors = {1, 2, 1, 3, 2, 2, 3, 1};
+
+    InterfaceGenerator generator;
+    StatsOptions stats_options;
+    stats_options.enabled = true;
+    stats_options.memory = true;
+    generator.set_stats_options(stats_options);
+    auto check = [&](const InterfaceSurface& surface) {
+        const auto& stats = *surface.stats;
+        const auto& memory = stats.memory;
+        assert(memory.triangulation_bytes > 0 && memory.cells_bytes > 0);
+        assert(memory.simplex_table_bytes > 0 && memory.filtration_bytes > 0);
+        assert(memory.barycenter_bytes >= surface.vertices.size() * sizeof(Point3D));
+        assert(memory.peak_bytes >= memory.simplex_table_bytes + memory.filtration_bytes + memory.barycenter_bytes);
+
+        size_t allocations = 0;
+        for (const auto& stage : stats.stages) allocations += stage.allocations;
+        assert(allocation_tracking_enabled() ? allocations > 0 : allocations == 0);
+        if (allocation_tracking_enabled()) {
+            assert(stats.stage(ComputationStage::Subdivision).allocations > 0);
+        }
+    };
+
+    check(generator.compute_interface_surface(points, colors, {}, false, false));
+    generator.set_executor(std::make_shared<ThreadPool>(2));
+    check(generator.compute_interface_surface(points, colors, {}, false, false));
+
+    std::cout << "  PASS\n";
+}
+
+void test_trace() {
+    std::cout << "Test: Trace\n";
+
+    Points points = {
+        {0.0, 0.0, 0.0},
+        {1.0, 0.0, 0.0},
+        {0.5, 1.0, 0.0},
+        {0.5, 0.5, 1.0},
+        {1.5, 0.5, 0.5}
+    };
+    ColorLabels colors = {1, 2, 1, 3, 2};
+
+    auto trace = std::make_shared<TraceRecorder>();
+    InterfaceGenerator generator;
+    generator.set_executor(std::make_shared<ThreadPool>(2));
+    generator.set_trace_recorder(trace);
+    generator.compute_interface_surface(points, colors, {}, false, false);
+
+    std::set<std::string> names;
+    for (const auto& event : trace->get_events()) {
+        names.insert(event.name);
+        assert(event.duration_ns >= 0);
+    }
+    for (const char* name : {"compute_interface_surface", "triangulation", "extraction", "subdivision", "sorting"}) {
+        assert(names.count(name));
+    }
+
+    // Chunks run on the workers but land in the caller's recorder
+    trace->clear();
+    ThreadPool pool(2);
+    {
+        TraceScope tracing(trace.get());
+        pool.parallel_for(100, [](size_t, size_t) {}, 10);
+    }
+    auto chunks = trace->get_events();
+    assert(chunks.size() == 10);
+    std::set<int64_t> indices;
+    for (const auto& event : chunks) indices.insert(event.index);
+    assert(indices.size() == 10 && *indices.begin() == 0 && *indices.rbegin() == 9);
+
+    // Off without a recorder
+    pool.parallel_for(100, [](size_t, size_t) {}, 10);
+    generator.set_trace_recorder(nullptr);
+    generator.compute_interface_surface(points, colors, {}, false, false);
+    assert(trace->get_events().size() == 10);
+
+    std::ostringstream json;
+    trace->write_chrome_trace(json);
+    assert(json.str().find("\"traceEvents\"") != std::string::npos);
+    assert(json.str().find("\"name\":\"chunk\"") != std::string::npos);
+    assert(json.str().find("\"thread_name\"") != std::string::npos);
+
+    std::cout << "  PASS\n";
+}
+
+void test_stage_observer() {
+    std::cout << "Test: Stage observer\n";
+
+    struct Counting : StageObserver {
+        std::mutex mutex;
+        std::array<int, 4> started = {};
+        std::array<int, 4> stopped = {};
+
+        void stage_started(ComputationStage stage) override {
+            std::lock_guard<std::mutex> lock(mutex);
+            ++started[static_cast<size_t>(stage)];
+        }
+        void stage_stopped(ComputationStage stage) override {
+            std::lock_guard<std::mutex> lock(mutex);
+            ++stopped[static_cast<size_t>(stage)];
+        }
+    };
+
+    Points points = {
+        {0.0, 0.0, 0.0},
+        {1.0, 0.0, 0.0},
+        {0.5, 1.0, 0.0},
+        {0.5, 0.5, 1.0},
+        {1.5, 0.5, 0.5}
+    };
+    ColorLabels colors = {1, 2, 1, 3, 2};
+
+    Counting observer;
+    set_stage_observer(&observer);
+    InterfaceGenerator generator;
+    generator.set_executor(std::make_shared<ThreadPool>(2));
+    generator.compute_interface_surface(points, colors, {}, false, false);
+    set_stage_observer(nullptr);
+    generator.compute_interface_surface(points, colors, {}, false, false);
+
+    for (size_t stage = 0; stage < 4; ++stage) {
+        assert(observer.started[stage] >= 1);
+        assert(observer.started[stage] == observer.stopped[stage]);
+    }
+
+    std::cout << "  PASS\n";
+}
+
+void test_preflight() {
+    std::cout << "Test: Preflight\n";
+
+    Points points;
+    ColorLabels color_labels;
+    uint32_t state = 11;
+    auto next = [&] {
+        state = state * 1664525u + 1013904223u;
+        return (state >> 8) / double(1u << 24);
+    };
+    for (int i = 0; i < 2000; ++i) {
+        points.push_back(Point3D(next(), next(), next()) * 10.0);
+        color_labels.push_back(i % 2);
+    }
+
+    InterfaceGenerator generator;
+    StatsOptions stats_options;
+    stats_options.enabled = true;
+    stats_options.memory = true;
+    generator.set_stats_options(stats_options);
+    auto surface = generator.compute_interface_surface(points, color_labels, {}, false, false);
+    const auto& actual = *surface.stats;
+
+    // Inputs up to the sample size are computed whole
+    PreflightOptions options;
+    options.sample_size = points.size();
+    auto exact = estimate_interface_surface(points, color_labels, {}, false, false, options);
+    assert(exact.exact && exact.sampled_points == points.size());
+    assert(exact.finite_cells == actual.finite_cells);
+    assert(exact.multicolored_cells == actual.multicolored_cells);
+    assert(exact.simplices_by_dimension == actual.simplices_by_dimension);
+
+    // Colors are mixed evenly, so two windows represent the whole input
+    options.sample_size = 800;
+    options.windows = 2;
+    auto sampled = estimate_interface_surface(points, color_labels, {}, false, false, options);
+    assert(!sampled.exact && sampled.sampled_points == 800);
+    auto close = [](size_t estimated, size_t expected) {
+        return estimated > expected / 2 && estimated < expected * 2;
+    };
+    assert(close(sampled.finite_cells, actual.finite_cells));
+    assert(close(sampled.multicolored_cells, actual.multicolored_cells));
+    assert(close(sampled.simplices_by_dimension[2], actual.simplices_by_dimension[2]));
+    assert(close(sampled.memory.peak_bytes, actual.memory.peak_bytes));
+    assert(sampled.seconds > 0 && sampled.time_exponent >= 1 && sampled.time_exponent <= 1.5);
+
+    options.windows = 0;
+    bool caught_exception = false;
+    try {
+        estimate_interface_surface(points, color_labels, {}, false, false, options);
+    } catch (const std::invalid_argument&) {
+        caught_exception = true;
+    }
+    assert(caught_exception);
+
+    std::cout << "  PASS\n";
+}
+
 int main() {
     std::cout << "Running DelaunayInterfaces C++ Tests\n";
     std::cout << "=====================================\n\n";
@@ -129,6 +1286,25 @@ int main() {
         test_simple_delaunay();
         test_weighted_alpha();
         test_input_validation();
+        test_mesh_export();
+        test_structure_parsing();
+        test_trajectory();
+        test_checkpoint_resume();
+        test_serialization();
+        test_array_views();
+        test_filtration_arrays();
+        test_shared_generator();
+        test_batch();
+        test_c_api();
+        test_progress_and_cancellation();
+        test_async();
+        test_executors();
+        test_pipelined_subdivision();
+        test_computation_stats();
+        test_memory_stats();
+        test_trace();
+        test_stage_observer();
+        test_preflight();
 
         std::cout << "\nAll tests passed!\n";
         return 0;
@@ -0,0 +1,162 @@
+// Checks that every way of computing a surface gives the same result as the
+// sequential reference, up to vertex ids and simplex order, on large
+// generated inputs. Usage: test_equivalence [num_points]
+
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <delaunay_interfaces/interface_generation.hpp>
+#include <delaunay_interfaces/equivalence.hpp>
+#include <delaunay_interfaces/serialization.hpp>
+#include <delaunay_interfaces/thread_pool.hpp>
+#include "workloads.hpp"
+
+using namespace delaunay_interfaces;
+using namespace delaunay_interfaces::bench;
+
+void expect_equivalent(const InterfaceSurface& a, const InterfaceSurface& b, const std::string& what,
+                       const EquivalenceOptions& options = {}) {
+    auto result = compare_surfaces(a, b, options);
+    if (!result) {
+        throw std::runtime_error(what + ": " + result.difference);
+    }
+}
+
+void expect_different(const InterfaceSurface& a, const InterfaceSurface& b, const std::string& what,
+                      const EquivalenceOptions& options = {}) {
+    if (compare_surfaces(a, b, options)) {
+        throw std::runtime_error(what + ": surfaces compare equal");
+    }
+}
+
+// The same surface with shuffled vertex ids and filtration order
+InterfaceSurface relabel(const InterfaceSurface& surface, uint64_t seed) {
+    std::mt19937_64 random(seed);
+    std::vector<int32_t> new_id(surface.vertices.size());
+    std::iota(new_id.begin(), new_id.end(), 1);
+    std::shuffle(new_id.begin(), new_id.end(), random);
+
+    InterfaceSurface result = surface;
+    for (size_t i = 0; i < surface.vertices.size(); ++i) {
+        result.vertices[new_id[i] - 1] = surface.vertices[i];
+        result.generators[new_id[i] - 1] = surface.generators[i];
+    }
+    for (auto& [simplex, value] : result.filtration) {
+        for (auto& id : simplex) id = new_id[id - 1];
+        std::reverse(simplex.begin(), simplex.end());
+    }
+    std::shuffle(result.filtration.begin(), result.filtration.end(), random);
+    return result;
+}
+
+void test_workload(const WorkloadOptions& options) {
+    std::cout << "Test: " << to_string(options.kind) << ", " << options.num_points << " points, "
+              << options.num_colors << " colors\n";
+
+    Workload workload = generate_workload(options);
+    const auto& points = workload.points;
+    const auto& colors = workload.color_labels;
+    const auto& radii = workload.radii;
+
+    InterfaceGenerator sequential;
+    auto reference = sequential.compute_interface_surface(points, colors, radii, true, true);
+
+    // Pipelined subdivision on a pool
+    InterfaceGenerator pooled;
+    pooled.set_executor(std::make_shared<ThreadPool>(4));
+    expect_equivalent(reference, pooled.compute_interface_surface(points, colors, radii, true, true),
+                      "ThreadPool");
+
+    // Parallel filter and sort: checkpointing turns the pipeline off
+    CheckpointOptions checkpoint;
+    checkpoint.path = (std::filesystem::temp_directory_path() / "delaunay_interfaces_equivalence").string();
+    checkpoint.interval = std::max<size_t>(1, reference.vertices.size() / 2);
+    pooled.set_checkpoint_options(checkpoint);
+    expect_equivalent(reference, pooled.compute_interface_surface(points, colors, radii, true, true),
+                      "ThreadPool with checkpoints");
+    std::filesystem::remove(checkpoint.path + ".tri");
+
+    // Vertices without generators are matched by coordinates
+    auto [vertices, filtration] = get_barycentric_subdivision_and_filtration(points, colors, radii, true, true);
+    InterfaceSurface plain{std::move(vertices), std::move(filtration), true, true, {}, std::nullopt};
+    expect_equivalent(reference, plain, "get_barycentric_subdivision_and_filtration");
+
+    expect_equivalent(reference, deserialize_interface_surface(serialize_interface_surface(reference)),
+                      "Serialization");
+    expect_equivalent(reference, relabel(reference, options.seed), "Relabeled");
+
+    std::cout << "  PASS\n";
+}
+
+void test_differences(size_t num_points) {
+    std::cout << "Test: Differences\n";
+
+    WorkloadOptions options;
+    options.num_points = num_points;
+    options.num_colors = 3;
+    Workload workload = generate_workload(options);
+    InterfaceGenerator generator;
+    auto reference = generator.compute_interface_surface(
+        workload.points, workload.color_labels, workload.radii, true, true);
+
+    auto shifted = relabel(reference, 7);
+    std::get<1>(shifted.filtration.front()) *= 1 + 1e-6;
+    expect_different(reference, shifted, "Shifted value");
+    EquivalenceOptions loose;
+    loose.value_tolerance = 1e-5;
+    expect_equivalent(reference, shifted, "Shifted value within tolerance", loose);
+
+    auto moved = reference;
+    moved.vertices.back().x() += 1e-3;
+    expect_different(reference, moved, "Moved vertex");
+
+    auto missing = reference;
+    missing.filtration.pop_back();
+    expect_different(reference, missing, "Missing simplex");
+
+    auto recolored = reference;
+    recolored.weighted = false;
+    expect_different(reference, recolored, "Complex type");
+
+    std::cout << "  PASS\n";
+}
+
+int main(int argc, char** argv) {
+    std::cout << "Running DelaunayInterfaces Equivalence Tests\n";
+    std::cout << "============================================\n\n";
+
+    try {
+        const size_t num_points = argc > 1 ? static_cast<size_t>(std::stod(argv[1])) : 50000;
+
+        WorkloadOptions uniform;
+        uniform.num_points = num_points;
+        test_workload(uniform);
+
+        WorkloadOptions clustered;
+        clustered.kind = WorkloadKind::Clustered;
+        clustered.num_points = num_points;
+        clustered.num_colors = 3;
+        clustered.radii = RadiiDistribution::Uniform;
+        test_workload(clustered);
+
+        WorkloadOptions protein;
+        protein.kind = WorkloadKind::ProteinLike;
+        protein.num_points = num_points;
+        protein.num_colors = 4;
+        protein.radii = RadiiDistribution::Atomic;
+        test_workload(protein);
+
+        test_differences(std::min<size_t>(num_points, 2000));
+
+        std::cout << "\nAll tests passed!\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "\nTest failed with exception: " << e.what() << "\n";
+        return 1;
+    }
+}